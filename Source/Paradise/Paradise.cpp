@@ -2,5 +2,21 @@
 
 #include "Paradise.h"
 #include "Modules/ModuleManager.h"
+#include "GAS/System/ParadiseGameplayTags.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Paradise, "Paradise" );
+/**
+ * @brief 게임 모듈
+ * @details 시작 시 C++에서 쓰는 게임플레이 태그를 네이티브 태그로 한 번 등록합니다. (런타임 문자열 조회 제거)
+ */
+class FParadiseModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		FDefaultGameModuleImpl::StartupModule();
+
+		FParadiseGameplayTags::InitializeNativeGameplayTags();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FParadiseModule, Paradise, "Paradise" );
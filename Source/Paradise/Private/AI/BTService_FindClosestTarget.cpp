@@ -3,8 +3,11 @@
 #include "AI/BTService_FindClosestTarget.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
+#include "Framework/System/AILODSubsystem.h"
+#include "Framework/System/AIWorkSchedulerSubsystem.h"
 #include "Characters/AIUnit/BaseUnit.h"
-#include "EngineUtils.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Framework/System/UnitTargetingSubsystem.h"
 
 UBTService_FindClosestTarget::UBTService_FindClosestTarget()
 {
@@ -16,7 +19,29 @@ void UBTService_FindClosestTarget::TickNode(UBehaviorTreeComponent& OwnerComp, u
 {
 	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
-	APawn* ControllingPawn = OwnerComp.GetAIOwner()->GetPawn();
+	// AI LOD: 화면 밖/후방 유닛은 다음 실행을 단계 배율만큼 늦춤
+	const float IntervalScale = UAILODSubsystem::GetServiceIntervalScale(OwnerComp);
+	if (IntervalScale > 1.f)
+	{
+		SetNextTickTime(NodeMemory, GetNextTickRemainingTime(NodeMemory) * IntervalScale);
+	}
+
+	// 프레임 예산 스케줄러가 켜져 있으면 예약만 하고, 실제 처리는 차례가 왔을 때 ExecuteScheduledWork에서
+	if (UAIWorkSchedulerSubsystem::IsEnabled())
+	{
+		if (UAIWorkSchedulerSubsystem* Scheduler = OwnerComp.GetWorld()->GetSubsystem<UAIWorkSchedulerSubsystem>())
+		{
+			Scheduler->Enqueue(OwnerComp, this);
+			return;
+		}
+	}
+
+	ExecuteScheduledWork(OwnerComp);
+}
+
+void UBTService_FindClosestTarget::ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp)
+{
+	APawn* ControllingPawn = OwnerComp.GetAIOwner() ? OwnerComp.GetAIOwner()->GetPawn() : nullptr;
 	ABaseUnit* SelfUnit = Cast<ABaseUnit>(ControllingPawn);
 	if (!SelfUnit) return;
 
@@ -36,25 +61,30 @@ void UBTService_FindClosestTarget::TickNode(UBehaviorTreeComponent& OwnerComp, u
 		return;
 	}
 
-	// 3. 타겟이 없거나 죽었다면 새로운 적을 찾음
+	// 3. 타겟이 없거나 죽었다면 프레임 단위 일괄 계산 결과에서 가장 가까운 적을 읽음
+	UWorld* World = OwnerComp.GetWorld();
 	ABaseUnit* ClosestEnemy = nullptr;
 	float MinDistance = SearchRadius;
 
-	for (TActorIterator<ABaseUnit> It(GetWorld()); It; ++It)
+	UUnitTargetingSubsystem* Targeting = World->GetSubsystem<UUnitTargetingSubsystem>();
+	if (Targeting)
 	{
-		ABaseUnit* OtherUnit = *It;
+		Targeting->RequestSearchRadius(SearchRadius);
+	}
 
-		// 나 자신이 아니고, 죽지 않았으며, 적군인 경우만 체크
-		if (OtherUnit != SelfUnit && !OtherUnit->bIsDead && SelfUnit->IsEnemy(OtherUnit))
+	if (Targeting && Targeting->GetNearestEnemy(SelfUnit, ClosestEnemy, MinDistance))
+	{
+		// 일괄 계산은 서비스들 중 가장 큰 반경으로 돌기 때문에 내 반경으로 다시 거름
+		if (MinDistance >= SearchRadius)
 		{
-			float Distance = FVector::Dist(SelfUnit->GetActorLocation(), OtherUnit->GetActorLocation());
-			if (Distance < MinDistance)
-			{
-				MinDistance = Distance;
-				ClosestEnemy = OtherUnit;
-			}
+			ClosestEnemy = nullptr;
 		}
 	}
+	else if (const UUnitSpatialGridSubsystem* Grid = World->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		// 이번 프레임에 스폰되어 테이블에 없는 유닛 등은 그리드를 직접 조회
+		ClosestEnemy = Grid->FindNearestEnemy(SelfUnit, SearchRadius, &MinDistance);
+	}
 
 	// 4. 결과 기록
 	if (ClosestEnemy)
@@ -2,9 +2,9 @@
 
 #include "AI/BTTask_Attack.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Characters/AIUnit/BaseUnit.h"
+#include "Framework/System/DamageQueueSubsystem.h"
 
 UBTTask_Attack::UBTTask_Attack()
 {
@@ -33,8 +33,11 @@ EBTNodeResult::Type UBTTask_Attack::ExecuteTask(UBehaviorTreeComponent& OwnerCom
 	// 타겟이 존재하고, 나와 적 관계일 때만 데미지 적용
 	if (MyUnit && TargetUnit && MyUnit->IsEnemy(TargetUnit))
 	{
-		float DamageAmount = 20.0f;
-		UGameplayStatics::ApplyDamage(TargetUnit, DamageAmount, AIController, MyUnit, nullptr);
+		// 즉시 TakeDamage를 부르지 않고 기록만 (데미지/사망은 AI 패스가 끝난 뒤 한 번에 처리)
+		if (UDamageQueueSubsystem* DamageQueue = OwnerComp.GetWorld()->GetSubsystem<UDamageQueueSubsystem>())
+		{
+			DamageQueue->PostAttack(MyUnit, TargetUnit, DamageMultiplier);
+		}
 
 		return EBTNodeResult::Succeeded;
 	}
@@ -4,6 +4,10 @@
 #include "AIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Navigation/PathFollowingComponent.h"
+#include "Framework/System/AIWorkSchedulerSubsystem.h"
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/MonsterAI.h"
 // #include "MonsterAI.h"
 
 UBTTask_MoveToTarget::UBTTask_MoveToTarget()
@@ -14,6 +18,46 @@ UBTTask_MoveToTarget::UBTTask_MoveToTarget()
 }
 
 EBTNodeResult::Type UBTTask_MoveToTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    // HomeBase로 향하는 호드 이동은 경로 탐색 없이 공유 흐름장을 따름
+    if (TryFollowFlowField(OwnerComp))
+    {
+        return EBTNodeResult::Succeeded;
+    }
+
+    // 경로 탐색은 비싸므로 스케줄러가 켜져 있으면 예산 안에서 실행하고 끝나면 FinishLatentTask로 결과 전달
+    if (UAIWorkSchedulerSubsystem::IsEnabled())
+    {
+        if (UAIWorkSchedulerSubsystem* Scheduler = OwnerComp.GetWorld()->GetSubsystem<UAIWorkSchedulerSubsystem>())
+        {
+            Scheduler->Enqueue(OwnerComp, this);
+            return EBTNodeResult::InProgress;
+        }
+    }
+
+    return RequestMove(OwnerComp);
+}
+
+EBTNodeResult::Type UBTTask_MoveToTarget::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+    // 아직 차례가 오지 않은 이동 요청은 취소
+    if (UAIWorkSchedulerSubsystem* Scheduler = OwnerComp.GetWorld()->GetSubsystem<UAIWorkSchedulerSubsystem>())
+    {
+        Scheduler->Cancel(OwnerComp, this);
+    }
+
+    return Super::AbortTask(OwnerComp, NodeMemory);
+}
+
+void UBTTask_MoveToTarget::ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp)
+{
+    // 대기 중에 다른 노드로 넘어갔다면 결과를 보내지 않음
+    if (OwnerComp.GetActiveNode() != this) return;
+
+    FinishLatentTask(OwnerComp, RequestMove(OwnerComp));
+}
+
+EBTNodeResult::Type UBTTask_MoveToTarget::RequestMove(UBehaviorTreeComponent& OwnerComp) const
 {
     AAIController* AIController = OwnerComp.GetAIOwner();
     UBlackboardComponent* BBComp = OwnerComp.GetBlackboardComponent();
@@ -22,6 +66,7 @@ EBTNodeResult::Type UBTTask_MoveToTarget::ExecuteTask(UBehaviorTreeComponent& Ow
     {
         FVector TargetLoc = BBComp->GetValueAsVector(TargetLocationKey.SelectedKeyName);
 
+        // 경로 캐시(UPathCacheSubsystem)는 컨트롤러의 FindPathForMoveRequest에서 조회됨
         if (AIController->MoveToLocation(TargetLoc) == EPathFollowingRequestResult::Failed)
         {
             return EBTNodeResult::Failed;
@@ -31,4 +76,20 @@ EBTNodeResult::Type UBTTask_MoveToTarget::ExecuteTask(UBehaviorTreeComponent& Ow
     }
 
     return EBTNodeResult::Failed;
-}
\ No newline at end of file
+}
+
+bool UBTTask_MoveToTarget::TryFollowFlowField(UBehaviorTreeComponent& OwnerComp) const
+{
+    UFlowFieldSubsystem* FlowField = OwnerComp.GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+    const AAIController* AIController = OwnerComp.GetAIOwner();
+    const UBlackboardComponent* BBComp = OwnerComp.GetBlackboardComponent();
+    if (!FlowField || !FlowField->IsReady() || !AIController || !BBComp) return false;
+
+    // 적 유닛을 쫓는 중이면 일반 경로 탐색
+    if (BBComp->GetValueAsObject(BB_KEYS::TargetActor)) return false;
+
+    const FVector TargetLoc = BBComp->GetValueAsVector(TargetLocationKey.SelectedKeyName);
+    if (!FlowField->IsGoalLocation(TargetLoc)) return false;
+
+    return FlowField->StartFollowing(Cast<ABaseUnit>(AIController->GetPawn()));
+}
@@ -37,8 +37,8 @@ EBTNodeResult::Type UBTTask_RangeAttack::ExecuteTask(UBehaviorTreeComponent& Own
         Direction.Z = 0.f;
         SelfPawn->SetActorRotation(Direction.Rotation());
 
-        // 공격 함수 실행
-        SelfUnit->PlayRangeAttack();
+        // 공격 함수 실행 (투사체 발사)
+        SelfUnit->PlayRangeAttack(Target);
 
         // 성공 반환
         return EBTNodeResult::Succeeded;
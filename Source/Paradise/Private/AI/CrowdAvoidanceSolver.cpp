@@ -0,0 +1,197 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/CrowdAvoidanceSolver.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include <atomic>
+
+namespace CrowdAvoidanceSolver
+{
+	/** @brief 셀 좌표 (X, Y)를 정렬/해시용 키 하나로 묶음 */
+	FORCEINLINE int64 MakeCellKey(int32 CellX, int32 CellY)
+	{
+		return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+	}
+
+	struct FCellRange
+	{
+		int32 Start = 0;
+		int32 Count = 0;
+	};
+
+	/** @brief 셀 순서로 정렬한 슬롯 목록 (같은 셀의 에이전트가 연속) */
+	struct FSortedAgents
+	{
+		TArray<int32> Slots;
+		TArray<int32> CellX;
+		TArray<int32> CellY;
+		TMap<int64, FCellRange> Cells;
+	};
+
+	void BuildSortedAgents(const FCrowdAgentSnapshot& Snapshot, float CellSize, FSortedAgents& Out)
+	{
+		const int32 NumAgents = Snapshot.Num();
+		const float InvCellSize = 1.f / CellSize;
+
+		TArray<TPair<int64, int32>> Keys;
+		Keys.SetNumUninitialized(NumAgents);
+		for (int32 Slot = 0; Slot < NumAgents; ++Slot)
+		{
+			const int32 CX = FMath::FloorToInt32(Snapshot.PosX[Slot] * InvCellSize);
+			const int32 CY = FMath::FloorToInt32(Snapshot.PosY[Slot] * InvCellSize);
+			Keys[Slot] = TPair<int64, int32>(MakeCellKey(CX, CY), Slot);
+		}
+		Algo::SortBy(Keys, &TPair<int64, int32>::Key);
+
+		Out.Slots.SetNumUninitialized(NumAgents);
+		Out.CellX.SetNumUninitialized(NumAgents);
+		Out.CellY.SetNumUninitialized(NumAgents);
+		Out.Cells.Reset();
+
+		for (int32 Sorted = 0; Sorted < NumAgents; ++Sorted)
+		{
+			const int64 Key = Keys[Sorted].Key;
+			const int32 Slot = Keys[Sorted].Value;
+
+			Out.Slots[Sorted] = Slot;
+			Out.CellX[Slot] = static_cast<int32>(Key >> 32);
+			Out.CellY[Slot] = static_cast<int32>(static_cast<uint32>(Key));
+
+			FCellRange& Range = Out.Cells.FindOrAdd(Key);
+			if (Range.Count == 0)
+			{
+				Range.Start = Sorted;
+			}
+			++Range.Count;
+		}
+	}
+
+	/** @brief Self가 Other에게 양보하는 비율 (우선순위가 낮을수록 큼) */
+	FORCEINLINE float YieldShare(float SelfPriority, float OtherPriority)
+	{
+		const float Sum = SelfPriority + OtherPriority;
+		return Sum > UE_KINDA_SMALL_NUMBER ? OtherPriority / Sum : 0.5f;
+	}
+}
+
+void FCrowdAgentSnapshot::Reset(int32 ExpectedAgents)
+{
+	PosX.Reset(ExpectedAgents);
+	PosY.Reset(ExpectedAgents);
+	VelX.Reset(ExpectedAgents);
+	VelY.Reset(ExpectedAgents);
+	Radius.Reset(ExpectedAgents);
+	Priority.Reset(ExpectedAgents);
+	MaxRadius = 0.f;
+}
+
+int32 FCrowdAgentSnapshot::Add(const FVector& Location, const FVector& Velocity, float InRadius, float InPriority)
+{
+	PosX.Add(static_cast<float>(Location.X));
+	PosY.Add(static_cast<float>(Location.Y));
+	VelX.Add(static_cast<float>(Velocity.X));
+	VelY.Add(static_cast<float>(Velocity.Y));
+	Radius.Add(InRadius);
+	MaxRadius = FMath::Max(MaxRadius, InRadius);
+	return Priority.Add(InPriority);
+}
+
+void FCrowdAvoidanceSolver::Solve(const FCrowdAgentSnapshot& Snapshot, const FCrowdAvoidanceParams& Params, FCrowdAvoidanceResults& OutResults, bool bParallel)
+{
+	using namespace CrowdAvoidanceSolver;
+
+	const int32 NumAgents = Snapshot.Num();
+	OutResults.Push.Init(FVector2f::ZeroVector, NumAgents);
+	OutResults.Velocity.SetNumUninitialized(NumAgents);
+	OutResults.NumOverlapping = 0;
+	if (NumAgents == 0) return;
+
+	for (int32 Slot = 0; Slot < NumAgents; ++Slot)
+	{
+		OutResults.Velocity[Slot] = FVector2f(Snapshot.VelX[Slot], Snapshot.VelY[Slot]);
+	}
+
+	// 두 에이전트가 닿을 수 있는 최대 거리 = 최대 반경 × 2 → 주변 3x3 셀만 보면 됨
+	const float CellSize = FMath::Max(Snapshot.MaxRadius * 2.f, 1.f);
+	FSortedAgents Agents;
+	BuildSortedAgents(Snapshot, CellSize, Agents);
+
+	const float Horizon = FMath::Max(Params.TimeHorizon, UE_KINDA_SMALL_NUMBER);
+	std::atomic<int32> NumOverlapping(0);
+
+	ParallelFor(NumAgents, [&](int32 Self)
+	{
+		const FVector2f SelfPos(Snapshot.PosX[Self], Snapshot.PosY[Self]);
+		const FVector2f SelfVel(Snapshot.VelX[Self], Snapshot.VelY[Self]);
+		const float SelfRadius = Snapshot.Radius[Self];
+		const float SelfPriority = Snapshot.Priority[Self];
+
+		FVector2f Push = FVector2f::ZeroVector;
+		FVector2f Avoid = FVector2f::ZeroVector;
+
+		// 주변 셀은 이웃이 속도 방향 뒤에 있어도 검사해야 하므로 항상 3x3
+		for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+		{
+			for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+			{
+				const FCellRange* Range = Agents.Cells.Find(MakeCellKey(Agents.CellX[Self] + OffsetX, Agents.CellY[Self] + OffsetY));
+				if (!Range) continue;
+
+				for (int32 Sorted = Range->Start; Sorted < Range->Start + Range->Count; ++Sorted)
+				{
+					const int32 Other = Agents.Slots[Sorted];
+					if (Other == Self) continue;
+
+					const FVector2f ToOther(Snapshot.PosX[Other] - SelfPos.X, Snapshot.PosY[Other] - SelfPos.Y);
+					const float MinDist = SelfRadius + Snapshot.Radius[Other];
+					const float DistSq = ToOther.SizeSquared();
+					const float Share = YieldShare(SelfPriority, Snapshot.Priority[Other]);
+
+					// 1. 겹침 분리
+					if (DistSq < FMath::Square(MinDist))
+					{
+						const float Dist = FMath::Sqrt(DistSq);
+
+						// 완전히 같은 위치면 슬롯 순서로 방향을 정해 서로 반대로 밀어냄
+						const FVector2f Away = Dist > UE_KINDA_SMALL_NUMBER ? -ToOther / Dist : (Self < Other ? FVector2f(1.f, 0.f) : FVector2f(-1.f, 0.f));
+						Push += Away * (MinDist - Dist) * Share;
+						continue;
+					}
+
+					// 2. 예측 회피: 상대 속도로 가장 가까워지는 시점에 겹치면 미리 틀어줌
+					const FVector2f RelVel = SelfVel - FVector2f(Snapshot.VelX[Other], Snapshot.VelY[Other]);
+					const float RelSpeedSq = RelVel.SizeSquared();
+					if (RelSpeedSq < UE_KINDA_SMALL_NUMBER) continue;
+
+					const float TimeToClosest = FVector2f::DotProduct(ToOther, RelVel) / RelSpeedSq;
+					if (TimeToClosest <= 0.f || TimeToClosest > Horizon) continue;
+
+					const FVector2f Closest = ToOther - RelVel * TimeToClosest;
+					const float ClosestDist = Closest.Size();
+					if (ClosestDist >= MinDist) continue;
+
+					const FVector2f Side = ClosestDist > UE_KINDA_SMALL_NUMBER ? -Closest / ClosestDist : FVector2f(-RelVel.Y, RelVel.X).GetSafeNormal();
+					const float Urgency = (1.f - TimeToClosest / Horizon) * (MinDist - ClosestDist) / MinDist;
+					Avoid += Side * Urgency * Share;
+				}
+			}
+		}
+
+		// 슬롯마다 한 스레드만 쓰므로 잠금 불필요
+		if (!Push.IsNearlyZero())
+		{
+			OutResults.Push[Self] = Push.GetClampedToMaxSize(Params.MaxPushPerFrame);
+			NumOverlapping.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		const float Speed = SelfVel.Size();
+		if (Speed > UE_KINDA_SMALL_NUMBER && !Avoid.IsNearlyZero() && Params.AvoidanceWeight > 0.f)
+		{
+			const FVector2f Desired = SelfVel / Speed + Avoid.GetClampedToMaxSize(1.f) * Params.AvoidanceWeight;
+			OutResults.Velocity[Self] = Desired.GetSafeNormal() * Speed;
+		}
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	OutResults.NumOverlapping = NumOverlapping.load();
+}
@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/ParadiseFactionTable.h"
+#include "Data/Assets/FactionConfig.h"
+#include "GAS/System/ParadiseGameplayTags.h"
+
+FParadiseFactionTable& FParadiseFactionTable::Get()
+{
+	static FParadiseFactionTable Instance;
+	return Instance;
+}
+
+FParadiseFactionTable::FParadiseFactionTable()
+{
+	FMemory::Memzero(HostileMasks);
+}
+
+uint8 FParadiseFactionTable::FindOrAddFaction(const FGameplayTag& FactionTag)
+{
+	check(IsInGameThread());
+
+	const int32 Existing = FactionTags.IndexOfByKey(FactionTag);
+	if (Existing != INDEX_NONE) return static_cast<uint8>(Existing);
+
+	if (FactionTags.Num() >= MaxFactions)
+	{
+		// 자리가 없으면 부모 태그가 같은 기존 진영에 합침 (없으면 첫 번째 진영)
+		const int32 Parent = FactionTags.IndexOfByPredicate([&FactionTag](const FGameplayTag& Tag) { return FactionTag.MatchesTag(Tag); });
+		UE_LOG(LogTemp, Error, TEXT("❌ [Faction] 진영이 %d개를 넘었습니다. %s 를 %s 로 취급합니다."),
+			MaxFactions, *FactionTag.ToString(), *FactionTags[FMath::Max(Parent, 0)].ToString());
+		return static_cast<uint8>(FMath::Max(Parent, 0));
+	}
+
+	const int32 NewId = FactionTags.Add(FactionTag);
+
+	// 새 진영의 행과 기존 진영들의 열만 채움
+	HostileMasks[NewId] = 0;
+	for (int32 Other = 0; Other <= NewId; ++Other)
+	{
+		if (EvaluateHostility(FactionTag, FactionTags[Other]))
+		{
+			HostileMasks[NewId] |= (1u << Other);
+		}
+		if (Other != NewId && EvaluateHostility(FactionTags[Other], FactionTag))
+		{
+			HostileMasks[Other] |= (1u << NewId);
+		}
+	}
+
+	return static_cast<uint8>(NewId);
+}
+
+const FGameplayTag& FParadiseFactionTable::GetFactionTag(uint8 FactionId) const
+{
+	return FactionTags.IsValidIndex(FactionId) ? FactionTags[FactionId] : FGameplayTag::EmptyTag;
+}
+
+void FParadiseFactionTable::ApplyConfig(const UFactionConfig* Config)
+{
+	check(IsInGameThread());
+
+	if (Config)
+	{
+		NeutralFactions = Config->NeutralFactions;
+		Relations = Config->Relations;
+		bHostileOnTagMismatch = Config->bHostileOnTagMismatch;
+	}
+	else
+	{
+		NeutralFactions.Reset();
+		Relations.Reset();
+		bHostileOnTagMismatch = true;
+	}
+
+	RebuildMasks();
+}
+
+bool FParadiseFactionTable::IsNeutral(const FGameplayTag& FactionTag) const
+{
+	const FGameplayTag& NeutralTag = FParadiseGameplayTags::Get().Unit_Faction_Neutral;
+
+	return FactionTag.MatchesTag(NeutralTag) || FactionTag.MatchesAny(NeutralFactions);
+}
+
+bool FParadiseFactionTable::EvaluateHostility(const FGameplayTag& A, const FGameplayTag& B) const
+{
+	// 진영 태그가 없는 유닛은 기존 규칙(빈 태그는 어떤 태그와도 일치하지 않음)대로 모두와 적대
+	if (!A.IsValid() || !B.IsValid()) return true;
+
+	if (A == B) return false;
+	if (IsNeutral(A) || IsNeutral(B)) return false;
+
+	for (const FFactionRelation& Relation : Relations)
+	{
+		const bool bForward = A.MatchesTag(Relation.FactionA) && B.MatchesTag(Relation.FactionB);
+		const bool bBackward = A.MatchesTag(Relation.FactionB) && B.MatchesTag(Relation.FactionA);
+		if (bForward || bBackward) return Relation.bHostile;
+	}
+
+	// 아군(Unit.Faction.Friendly.*) 하위 진영끼리는 설정이 없으면 동맹 (플레이어 ↔ 패밀리어)
+	const FGameplayTag& FriendlyTag = FParadiseGameplayTags::Get().Unit_Faction_Friendly;
+	if (A.MatchesTag(FriendlyTag) && B.MatchesTag(FriendlyTag)) return false;
+
+	// 기존 ABaseUnit::IsEnemy 규칙
+	return bHostileOnTagMismatch && !A.MatchesTag(B);
+}
+
+void FParadiseFactionTable::RebuildMasks()
+{
+	FMemory::Memzero(HostileMasks);
+
+	for (int32 A = 0; A < FactionTags.Num(); ++A)
+	{
+		for (int32 B = 0; B < FactionTags.Num(); ++B)
+		{
+			if (EvaluateHostility(FactionTags[A], FactionTags[B]))
+			{
+				HostileMasks[A] |= (1u << B);
+			}
+		}
+	}
+}
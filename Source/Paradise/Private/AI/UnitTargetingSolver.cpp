@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/UnitTargetingSolver.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+#include "Algo/Sort.h"
+
+namespace UnitTargetingSolver
+{
+	/** @brief 셀 좌표 (X, Y)를 정렬/해시용 키 하나로 묶음 */
+	FORCEINLINE int64 MakeCellKey(int32 CellX, int32 CellY)
+	{
+		return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+	}
+
+	struct FCellRange
+	{
+		int32 Start = 0;
+		int32 Count = 0;
+	};
+
+	/** @brief 셀 순서로 재배치한 스냅샷 (같은 셀의 유닛이 메모리상 연속) */
+	struct FSortedUnits
+	{
+		TArray<float> PosX;
+		TArray<float> PosY;
+		TArray<float> PosZ;
+		TArray<int32> Faction;
+		TArray<int32> OriginalSlot;
+		TArray<int32> CellX;
+		TArray<int32> CellY;
+		TMap<int64, FCellRange> Cells;
+	};
+
+	void BuildSortedUnits(const FUnitTargetingSnapshot& Snapshot, float CellSize, FSortedUnits& Out)
+	{
+		const int32 NumUnits = Snapshot.Num();
+		const float InvCellSize = 1.f / CellSize;
+
+		TArray<TPair<int64, int32>> Keys;
+		Keys.SetNumUninitialized(NumUnits);
+		for (int32 Slot = 0; Slot < NumUnits; ++Slot)
+		{
+			const int32 CX = FMath::FloorToInt32(Snapshot.PosX[Slot] * InvCellSize);
+			const int32 CY = FMath::FloorToInt32(Snapshot.PosY[Slot] * InvCellSize);
+			Keys[Slot] = TPair<int64, int32>(MakeCellKey(CX, CY), Slot);
+		}
+		Algo::SortBy(Keys, &TPair<int64, int32>::Key);
+
+		Out.PosX.SetNumUninitialized(NumUnits);
+		Out.PosY.SetNumUninitialized(NumUnits);
+		Out.PosZ.SetNumUninitialized(NumUnits);
+		Out.Faction.SetNumUninitialized(NumUnits);
+		Out.OriginalSlot.SetNumUninitialized(NumUnits);
+		Out.CellX.SetNumUninitialized(NumUnits);
+		Out.CellY.SetNumUninitialized(NumUnits);
+		Out.Cells.Reset();
+
+		for (int32 Sorted = 0; Sorted < NumUnits; ++Sorted)
+		{
+			const int64 Key = Keys[Sorted].Key;
+			const int32 Slot = Keys[Sorted].Value;
+
+			Out.PosX[Sorted] = Snapshot.PosX[Slot];
+			Out.PosY[Sorted] = Snapshot.PosY[Slot];
+			Out.PosZ[Sorted] = Snapshot.PosZ[Slot];
+			Out.Faction[Sorted] = Snapshot.Faction[Slot];
+			Out.OriginalSlot[Sorted] = Slot;
+			Out.CellX[Sorted] = static_cast<int32>(Key >> 32);
+			Out.CellY[Sorted] = static_cast<int32>(static_cast<uint32>(Key));
+
+			FCellRange& Range = Out.Cells.FindOrAdd(Key);
+			if (Range.Count == 0)
+			{
+				Range.Start = Sorted;
+			}
+			++Range.Count;
+		}
+	}
+
+	/** @brief 셀 하나(연속 구간)에서 더 가까운 적을 찾아 Best를 갱신 (4개씩 SIMD) */
+	FORCEINLINE void ScanRange(const FSortedUnits& Units, const FCellRange& Range, int32 Self, uint32 HostileMask,
+		const VectorRegister4Float& SelfX, const VectorRegister4Float& SelfY, const VectorRegister4Float& SelfZ,
+		float& BestDistSq, int32& BestSorted)
+	{
+		const int32 End = Range.Start + Range.Count;
+		int32 Index = Range.Start;
+
+		for (; Index + 3 < End; Index += 4)
+		{
+			const VectorRegister4Float DX = VectorSubtract(VectorLoad(&Units.PosX[Index]), SelfX);
+			const VectorRegister4Float DY = VectorSubtract(VectorLoad(&Units.PosY[Index]), SelfY);
+			const VectorRegister4Float DZ = VectorSubtract(VectorLoad(&Units.PosZ[Index]), SelfZ);
+			const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+
+			// 4개 모두 현재 최선보다 멀면 진영 검사 없이 통과
+			const VectorRegister4Float Best = VectorSetFloat1(BestDistSq);
+			if (!VectorMaskBits(VectorCompareLT(DistSq, Best))) continue;
+
+			alignas(16) float Dist4[4];
+			VectorStoreAligned(DistSq, Dist4);
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const int32 Other = Index + Lane;
+				if (Dist4[Lane] < BestDistSq && Other != Self && (HostileMask & (1u << Units.Faction[Other])))
+				{
+					BestDistSq = Dist4[Lane];
+					BestSorted = Other;
+				}
+			}
+		}
+
+		for (; Index < End; ++Index)
+		{
+			if (Index == Self || !(HostileMask & (1u << Units.Faction[Index]))) continue;
+
+			const float DX = Units.PosX[Index] - Units.PosX[Self];
+			const float DY = Units.PosY[Index] - Units.PosY[Self];
+			const float DZ = Units.PosZ[Index] - Units.PosZ[Self];
+			const float DistSq = DX * DX + DY * DY + DZ * DZ;
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestSorted = Index;
+			}
+		}
+	}
+}
+
+void FUnitTargetingSnapshot::Reset(int32 ExpectedUnits)
+{
+	PosX.Reset(ExpectedUnits);
+	PosY.Reset(ExpectedUnits);
+	PosZ.Reset(ExpectedUnits);
+	Faction.Reset(ExpectedUnits);
+	HostileMask.Reset();
+}
+
+int32 FUnitTargetingSnapshot::Add(const FVector& Location, int32 FactionIndex)
+{
+	check(FactionIndex >= 0 && FactionIndex < MaxFactions);
+
+	PosX.Add(static_cast<float>(Location.X));
+	PosY.Add(static_cast<float>(Location.Y));
+	PosZ.Add(static_cast<float>(Location.Z));
+	return Faction.Add(FactionIndex);
+}
+
+void FUnitTargetingSolver::Solve(const FUnitTargetingSnapshot& Snapshot, float MaxRadius, FUnitTargetingResults& OutResults, bool bParallel)
+{
+	using namespace UnitTargetingSolver;
+
+	const int32 NumUnits = Snapshot.Num();
+	OutResults.TargetSlot.Init(INDEX_NONE, NumUnits);
+	OutResults.Distance.Init(MAX_flt, NumUnits);
+	if (NumUnits == 0 || MaxRadius <= 0.f) return;
+
+	// 셀 크기를 탐색 반경과 같게 두면 주변 3x3 셀만 보면 됩니다.
+	FSortedUnits Units;
+	BuildSortedUnits(Snapshot, MaxRadius, Units);
+
+	const float MaxRadiusSq = FMath::Square(MaxRadius);
+
+	ParallelFor(NumUnits, [&](int32 Self)
+	{
+		const uint32 HostileMask = Snapshot.HostileMask.IsValidIndex(Units.Faction[Self]) ? Snapshot.HostileMask[Units.Faction[Self]] : 0u;
+		if (HostileMask == 0) return;
+
+		const VectorRegister4Float SelfX = VectorSetFloat1(Units.PosX[Self]);
+		const VectorRegister4Float SelfY = VectorSetFloat1(Units.PosY[Self]);
+		const VectorRegister4Float SelfZ = VectorSetFloat1(Units.PosZ[Self]);
+
+		float BestDistSq = MaxRadiusSq;
+		int32 BestSorted = INDEX_NONE;
+
+		for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+		{
+			for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+			{
+				const FCellRange* Range = Units.Cells.Find(MakeCellKey(Units.CellX[Self] + OffsetX, Units.CellY[Self] + OffsetY));
+				if (!Range) continue;
+
+				ScanRange(Units, *Range, Self, HostileMask, SelfX, SelfY, SelfZ, BestDistSq, BestSorted);
+			}
+		}
+
+		if (BestSorted != INDEX_NONE)
+		{
+			// 슬롯마다 한 스레드만 쓰므로 잠금 불필요
+			const int32 SelfSlot = Units.OriginalSlot[Self];
+			OutResults.TargetSlot[SelfSlot] = Units.OriginalSlot[BestSorted];
+			OutResults.Distance[SelfSlot] = FMath::Sqrt(BestDistSq);
+		}
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FUnitTargetingSolver::SolveBruteForce(const FUnitTargetingSnapshot& Snapshot, float MaxRadius, FUnitTargetingResults& OutResults)
+{
+	const int32 NumUnits = Snapshot.Num();
+	OutResults.TargetSlot.Init(INDEX_NONE, NumUnits);
+	OutResults.Distance.Init(MAX_flt, NumUnits);
+
+	for (int32 Self = 0; Self < NumUnits; ++Self)
+	{
+		const uint32 HostileMask = Snapshot.HostileMask.IsValidIndex(Snapshot.Faction[Self]) ? Snapshot.HostileMask[Snapshot.Faction[Self]] : 0u;
+		const FVector SelfLocation(Snapshot.PosX[Self], Snapshot.PosY[Self], Snapshot.PosZ[Self]);
+
+		float MinDistance = MaxRadius;
+		for (int32 Other = 0; Other < NumUnits; ++Other)
+		{
+			if (Other == Self || !(HostileMask & (1u << Snapshot.Faction[Other]))) continue;
+
+			const float Distance = FVector::Dist(SelfLocation, FVector(Snapshot.PosX[Other], Snapshot.PosY[Other], Snapshot.PosZ[Other]));
+			if (Distance < MinDistance)
+			{
+				MinDistance = Distance;
+				OutResults.TargetSlot[Self] = Other;
+				OutResults.Distance[Self] = Distance;
+			}
+		}
+	}
+}
@@ -3,9 +3,17 @@
 #include "Characters/AIUnit/BaseUnit.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "AIController.h"
 #include "BrainComponent.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "Framework/InGame/MyAIController.h"
 #include "Framework/System/ObjectPoolSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Framework/System/AILODSubsystem.h"
+#include "Framework/System/CrowdSubsystem.h"
+#include "Framework/System/UnitDeathEventSubsystem.h"
+#include "Framework/System/ProjectileSubsystem.h"
 
 ABaseUnit::ABaseUnit()
 {
@@ -14,6 +22,41 @@ ABaseUnit::ABaseUnit()
 	bIsDead = false;
 }
 
+void ABaseUnit::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 레벨 배치 유닛(HomeBase 등)은 InitializeUnit을 거치지 않으므로 여기서 진영 ID 변환
+	FactionId = FParadiseFactionTable::Get().FindOrAddFaction(FactionTag);
+
+	// 블루프린트에서 정한 애니메이션 갱신 방식은 AI LOD가 바꾸기 전에 저장 (단계 0에서 되돌림)
+	if (const USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		DefaultAnimTickOption = MeshComp->VisibilityBasedAnimTickOption;
+	}
+
+	// 레벨 배치 유닛(HomeBase 등) 포함, 월드에 들어오는 순간 격자에 등록
+	if (UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		Grid->RegisterUnit(this);
+	}
+}
+
+void ABaseUnit::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		Grid->UnregisterUnit(this);
+	}
+
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->NotifyDespawn(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ABaseUnit::OnPoolActivate_Implementation()
 {
 	bIsDead = false;
@@ -27,12 +70,27 @@ void ABaseUnit::OnPoolActivate_Implementation()
 		MoveComp->Velocity = FVector::ZeroVector;
 		MoveComp->SetMovementMode(MOVE_Walking);
 	}
+
+	if (UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		Grid->RegisterUnit(this);
+	}
+
+	// 이전 생애의 낮은 AI LOD 단계를 물려받지 않도록 원복 (다음 평가에서 다시 계산)
+	if (UAILODSubsystem* LODSubsystem = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		LODSubsystem->ResetUnit(this);
+	}
 }
 
 void ABaseUnit::OnPoolDeactivate_Implementation()
 {
-	// 풀로 돌아갈 때 AI 로직 중지 및 컨트롤러 해제
-	if (AAIController* AIC = Cast<AAIController>(GetController()))
+	// 풀로 돌아갈 때 컨트롤러는 유지한 채 휴면 상태로 전환 (재사용 시 BT/블랙보드 재생성 방지)
+	if (AMyAIController* MyAIC = Cast<AMyAIController>(GetController()))
+	{
+		MyAIC->EnterDormant();
+	}
+	else if (AAIController* AIC = Cast<AAIController>(GetController()))
 	{
 		if (AIC->GetBrainComponent())
 		{
@@ -41,6 +99,18 @@ void ABaseUnit::OnPoolDeactivate_Implementation()
 		AIC->UnPossess();
 	}
 
+	// 풀에서 대기 중인 유닛은 쿼리에 잡히지 않도록 해제
+	if (UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		Grid->UnregisterUnit(this);
+	}
+
+	// 이 유닛을 노리던 컨트롤러들의 타겟 정리 (사망으로 이미 알렸으면 구독자가 없어 바로 끝남)
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->NotifyDespawn(this);
+	}
+
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 	SetActorTickEnabled(false);
@@ -52,7 +122,13 @@ void ABaseUnit::InitializeUnit(FAIUnitStats* InStats, FAIUnitAssets* InAssets)
 	{
 		MaxHP = InStats->BaseMaxHP;
 		HP = MaxHP;
-		this->FactionTag = InStats->FactionTag;
+		SetFactionTag(InStats->FactionTag);
+		RoleTypeTag = InStats->RoleTypeTag;
+
+		// 전투 스탯 캐시 (데미지 큐/투사체가 데이터 행을 다시 찾지 않도록)
+		AttackPower = InStats->BaseAttackPower;
+		Defense = InStats->BaseDefense;
+		CritRate = InStats->BaseCritRate;
 
 		if (GetCharacterMovement())
 		{
@@ -60,26 +136,59 @@ void ABaseUnit::InitializeUnit(FAIUnitStats* InStats, FAIUnitAssets* InAssets)
 		}
 	}
 
+	// 유닛끼리 캡슐로 밀어내지 않고 군중 회피로 처리 (CrowdUnit 채널)
+	if (const UCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UCrowdSubsystem>())
+	{
+		Crowd->ApplyCrowdCollision(this);
+	}
+
 	if (InAssets)
 	{
+		// 원거리 평타 (발사 시마다 데이터 행을 다시 찾지 않도록 보관)
+		ProjectileType = InAssets->ProjectileType;
+		BasicAttackEffect = InAssets->BasicAttackEffect;
+
 		// 유닛 크기 설정
 		SetActorScale3D(FVector(InAssets->Scale));
 
-		// 스켈레탈 메시 로드 및 적용
+		// 스켈레탈 메시 로드 및 적용 (같은 종류로 재사용될 때는 메시/애님 인스턴스 재초기화를 건너뜀)
 		if (!InAssets->SkeletalMesh.IsNull())
 		{
 			USkeletalMesh* LoadedMesh = InAssets->SkeletalMesh.LoadSynchronous();
-			if (LoadedMesh) GetMesh()->SetSkeletalMesh(LoadedMesh);
+			if (LoadedMesh && GetMesh()->GetSkeletalMeshAsset() != LoadedMesh) GetMesh()->SetSkeletalMesh(LoadedMesh);
 		}
 
 		// 애니메이션 블루프린트 설정
-		if (InAssets->AnimBlueprint)
+		if (InAssets->AnimBlueprint && GetMesh()->GetAnimClass() != InAssets->AnimBlueprint)
 		{
 			GetMesh()->SetAnimInstanceClass(InAssets->AnimBlueprint);
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[%s] Initialized. Faction: %s"), *GetName(), *FactionTag.ToString());
+	UE_LOG(LogTemp, Verbose, TEXT("[%s] Initialized. Faction: %s"), *GetName(), *FactionTag.ToString());
+}
+
+void ABaseUnit::StartAIBehavior(const FAIUnitStats* InStats, const FAIUnitAssets* InAssets)
+{
+	if (!InAssets || InAssets->BehaviorTree.IsNull()) return;
+
+	// AI 컨트롤러 확인 (풀에서 재사용된 유닛은 휴면 상태의 컨트롤러를 그대로 가지고 있음)
+	AMyAIController* AIC = Cast<AMyAIController>(GetController());
+
+	// 컨트롤러가 없다면 생성
+	if (!AIC)
+	{
+		SpawnDefaultController();
+		AIC = Cast<AMyAIController>(GetController());
+	}
+
+	if (AIC)
+	{
+		// 블랙보드 스탯 주입 + BT 실행 (같은 BT로 휴면 중이면 재시작만 함)
+		UBehaviorTree* BT = InAssets->BehaviorTree.LoadSynchronous();
+		AIC->SetUseAIPerception(InAssets->bUseAIPerception);
+		AIC->StartUnitBehavior(BT, InStats);
+	}
 }
 
 float ABaseUnit::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
@@ -87,20 +196,34 @@ float ABaseUnit::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent,
 	if (bIsDead) return 0.0f;
 
 	float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInstigator, DamageCauser);
-	HP -= ActualDamage;
-
-	if (HP <= 0.0f)
+	if (ApplyQueuedDamage(ActualDamage))
 	{
-		bIsDead = true;
 		Die();
 	}
 	return ActualDamage;
 }
 
+bool ABaseUnit::ApplyQueuedDamage(float Damage)
+{
+	if (bIsDead) return false;
+
+	HP -= Damage;
+	if (HP > 0.0f) return false;
+
+	bIsDead = true;
+	return true;
+}
+
 void ABaseUnit::Die()
 {
 	if (UWorld* World = GetWorld())
 	{
+		// 이 유닛을 노리던 컨트롤러들의 블랙보드를 즉시 비우고 재타게팅 예약
+		if (UUnitDeathEventSubsystem* DeathEvents = World->GetSubsystem<UUnitDeathEventSubsystem>())
+		{
+			DeathEvents->NotifyDeath(this);
+		}
+
 		if (UObjectPoolSubsystem* PoolSubsystem = World->GetSubsystem<UObjectPoolSubsystem>())
 		{
 			// 사망 시 풀로 반환
@@ -109,14 +232,46 @@ void ABaseUnit::Die()
 	}
 }
 
+void ABaseUnit::SetFactionTag(const FGameplayTag& NewFactionTag)
+{
+	FactionTag = NewFactionTag;
+	FactionId = FParadiseFactionTable::Get().FindOrAddFaction(FactionTag);
+
+	// 진영이 바뀌었을 수 있으므로 격자 버킷 갱신
+	if (UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		Grid->UpdateUnitFaction(this);
+	}
+}
+
 bool ABaseUnit::IsEnemy(ABaseUnit* OtherUnit)
 {
 	if (!OtherUnit || OtherUnit == this) return false;
-	// 태그가 다르면 적군으로 간주
-	return !this->FactionTag.MatchesTag(OtherUnit->FactionTag);
+	// 진영 관계는 FParadiseFactionTable에 미리 계산되어 있음 (기본: 태그가 다르면 적군)
+	return FParadiseFactionTable::Get().IsHostile(FactionId, OtherUnit->FactionId);
 }
 
-void ABaseUnit::PlayRangeAttack()
+void ABaseUnit::PlayRangeAttack(AActor* Target)
 {
-	UE_LOG(LogTemp, Log, TEXT("Range Attack Executed!"));
+	if (bIsDead || !Target) return;
+
+	UProjectileSubsystem* ProjectileSubsystem = GetWorld()->GetSubsystem<UProjectileSubsystem>();
+	if (!ProjectileSubsystem) return;
+
+	// 발사 위치: 총구 소켓이 있으면 소켓, 없으면 캡슐 앞쪽
+	static const FName MuzzleSocket(TEXT("Muzzle"));
+	const FVector Start = GetMesh() && GetMesh()->DoesSocketExist(MuzzleSocket)
+		? GetMesh()->GetSocketLocation(MuzzleSocket)
+		: GetActorLocation() + GetActorForwardVector() * GetCapsuleComponent()->GetScaledCapsuleRadius();
+
+	// 도착 시간만큼 대상의 이동을 앞서 조준 (한 번 근사)
+	const float Speed = ProjectileSubsystem->GetTypeSettings(ProjectileType).Speed;
+	const FVector TargetLocation = Target->GetActorLocation();
+	const float FlightTime = FVector::Dist(Start, TargetLocation) / FMath::Max(Speed, 1.f);
+	const FVector AimLocation = TargetLocation + Target->GetVelocity() * FlightTime;
+
+	if (!ProjectileSubsystem->FireProjectile(this, ProjectileType, Start, AimLocation - Start, AttackPower, FactionId, BasicAttackEffect))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[%s] 투사체 최대 개수 초과로 발사하지 못했습니다."), *GetName());
+	}
 }
\ No newline at end of file
@@ -2,7 +2,8 @@
 
 
 #include "Characters/Base/CharacterBase.h"
-#include "Framework/System/ObjectPoolSubsystem.h"
+#include "Framework/System/DamagePopupSubsystem.h"
+#include "Framework/System/UnitDeathEventSubsystem.h"
 #include "Components/WidgetComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "AttributeSet.h"
@@ -114,7 +115,7 @@ void ACharacterBase::ResetHitFlash()
 	}
 }
 
-void ACharacterBase::SpawnDamagePopup(float DamageAmount)
+void ACharacterBase::SpawnDamagePopup(float DamageAmount, bool bIsCritical)
 {
 	if (DamageAmount <= 0.0f) return;
 
@@ -122,16 +123,11 @@ void ACharacterBase::SpawnDamagePopup(float DamageAmount)
 
 	if (!world) return;
 
-	UObjectPoolSubsystem* subsystem = world->GetSubsystem<UObjectPoolSubsystem>();
-
-	if (subsystem && DamageTextActorClass)
+	if (UDamagePopupSubsystem* subsystem = world->GetSubsystem<UDamagePopupSubsystem>())
 	{
-		//스폰 및 데미지 수치 전달 로직 
-		//subsystem->SpawnPoolActor<>();
+		//같은 프레임 피격은 서브시스템에서 합산됨
+		subsystem->AddDamagePopup(this, DamageAmount, bIsCritical);
 	}
-
-
-
 }
 
 void ACharacterBase::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -147,6 +143,12 @@ void ACharacterBase::Die()
 
 	UE_LOG(LogTemp, Error, TEXT("☠️ [CharacterBase] Die() 로직 시작 - 래그돌 전환"));
 
+	// 이 캐릭터를 노리던 AI들의 블랙보드를 즉시 비우고 재타게팅 예약
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->NotifyDeath(this);
+	}
+
 	//물리적 처리 (서 있는 캡슐은 끄고, 메쉬는 흐물거리는 래그돌로)
 	if (GetCapsuleComponent())
 	{
@@ -18,9 +18,8 @@
 #include "Data/Structs/ItemStructs.h"
 #include "Data/Structs/InputStructs.h"
 #include "Data/Assets/ParadiseInputConfig.h" 
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
-#include "AbilitySystemBlueprintLibrary.h"
+#include "Components/MeleeHitDetectionComponent.h"
 
 APlayerBase::APlayerBase()
 {
@@ -52,6 +51,8 @@ APlayerBase::APlayerBase()
     BootsMesh->SetupAttachment(GetMesh());
     BootsMesh->SetLeaderPoseComponent(GetMesh());
 
+    MeleeHitDetection = CreateDefaultSubobject<UMeleeHitDetectionComponent>(TEXT("MeleeHitDetection"));
+
     bUseControllerRotationYaw = false;
     GetCharacterMovement()->bOrientRotationToMovement = true;
     GetCharacterMovement()->RotationRate = FRotator(0.0f, 720.0f, 0.0f);
@@ -173,53 +174,6 @@ void APlayerBase::InitializePlayer(APlayerData* InPlayerData)
     UE_LOG(LogTemp, Log, TEXT("💪 [PlayerBase] 육체 초기화 완료!"));
 }
 
-void APlayerBase::CheckHit()
-{
-    FVector SocketLocation = GetMesh()->GetSocketLocation(TEXT("hand_r")); // 무기 소켓 이름
-
-    // 2. 트레이스 설정 (반경 50cm짜리 구체를 그림)
-    TArray<AActor*> ActorsToIgnore;
-    ActorsToIgnore.Add(this); // 나는 때리면 안 됨
-
-    FHitResult HitResult;
-    bool bHit = UKismetSystemLibrary::SphereTraceSingle(
-        GetWorld(),
-        SocketLocation,      // 시작점
-        SocketLocation,      // 끝점 (제자리에서 구체 검사)
-        50.0f,               // 반경 (큐브 크기에 맞춰 조절)
-        UEngineTypes::ConvertToTraceType(ECC_Pawn), // 폰(캐릭터)만 검사
-        false,               // 복잡한 충돌(Mesh) 말고 단순 캡슐 충돌 검사
-        ActorsToIgnore,
-        EDrawDebugTrace::ForDuration, // 디버그 선 그리기 (빨간 공 보임)
-        HitResult,
-        true
-    );
-
-    // 3. 무언가 맞았다면?
-    if (bHit && HitResult.GetActor())
-    {
-        AActor* HitActor = HitResult.GetActor();
-
-        // 4. 이미 때린 놈이면 패스 (다단히트 방지)
-        if (HitActors.Contains(HitActor)) return;
-        HitActors.Add(HitActor); // 목록에 추가
-
-        // 5. [핵심] GAS로 "나 때렸어!" 신호 보내기
-        // MeleeBase.cpp에서 기다리는 태그: "Event.Montage.Hit"
-        FGameplayEventData Payload;
-        Payload.Instigator = this;
-        Payload.Target = HitActor;
-
-        // 태그: MeleeBase의 HitEventTag와 똑같아야 함!
-        FGameplayTag HitTag = FGameplayTag::RequestGameplayTag(FName("Event.Montage.Hit"));
-
-        UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(this, HitTag, Payload);
-
-        UE_LOG(LogTemp, Warning, TEXT("👊 [PlayerBase] 타격 성공! 대상: %s"), *HitActor->GetName());
-
-    }
-}
-
 UAbilitySystemComponent* APlayerBase::GetAbilitySystemComponent() const
 {
 	return LinkedPlayerData.IsValid() ? LinkedPlayerData->GetAbilitySystemComponent() : nullptr;
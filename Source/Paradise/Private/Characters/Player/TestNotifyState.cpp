@@ -2,18 +2,29 @@
 
 
 #include "Characters/Player/TestNotifyState.h"
-#include "Characters/Base/PlayerBase.h"
+#include "Components/MeleeHitDetectionComponent.h"
 
-void UTestNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+void UTestNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	if (!MeshComp) return;
+	if (!MeshComp || !MeshComp->GetOwner()) return;
 
-	// 메시의 주인(캐릭터)를 찾아서
-	if (APlayerBase* Player = Cast<APlayerBase>(MeshComp->GetOwner()))
+	// 메시의 주인(캐릭터)에게 판정 컴포넌트가 있으면 스윙 시작
+	if (UMeleeHitDetectionComponent* HitDetection = MeshComp->GetOwner()->FindComponentByClass<UMeleeHitDetectionComponent>())
 	{
-		// "판정 검사해줘!" 라고 요청 (이 함수는 아래에서 만들 겁니다)
-		Player->CheckHit();
+		HitDetection->BeginSwing(MeshComp);
+	}
+}
+
+void UTestNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+
+	if (!MeshComp || !MeshComp->GetOwner()) return;
+
+	if (UMeleeHitDetectionComponent* HitDetection = MeshComp->GetOwner()->FindComponentByClass<UMeleeHitDetectionComponent>())
+	{
+		HitDetection->EndSwing();
 	}
 }
@@ -8,6 +8,7 @@
 #include "Framework/Core/ParadiseGameInstance.h"
 #include "Objects/FamiliarSpawner.h"
 #include "Data/Structs/UnitStructs.h"
+#include "Framework/System/BattleRandomSubsystem.h"
 #include "TimerManager.h"
 
 UFamiliarSummonComponent::UFamiliarSummonComponent()
@@ -168,7 +169,9 @@ FSummonSlotInfo UFamiliarSummonComponent::GenerateRandomSlot(UDataTable* StatsTa
 	FSummonSlotInfo NewSlot;
 	TArray<FName> RowNames = StatsTable->GetRowNames();
 
-	int32 RandomIndex = FMath::RandRange(0, RowNames.Num() - 1);
+	// 전투 시드 스트림 (같은 시드면 같은 상점 목록)
+	FRandomStream* ShopStream = UBattleRandomSubsystem::FindStream(this, EBattleRandomStream::SummonShop);
+	int32 RandomIndex = ShopStream ? ShopStream->RandRange(0, RowNames.Num() - 1) : FMath::RandRange(0, RowNames.Num() - 1);
 	FName SelectedID = RowNames[RandomIndex];
 
 	FFamiliarStats* Stats = StatsTable->FindRow<FFamiliarStats>(SelectedID, TEXT(""));
@@ -3,6 +3,7 @@
 
 #include "Components/InventoryComponent.h"
 #include "Framework/Core/ParadiseGameInstance.h"
+#include "GAS/System/ParadiseGameplayTags.h"
 
 // Sets default values for this component's properties
 UInventoryComponent::UInventoryComponent()
@@ -335,10 +336,12 @@ EEquipmentSlot UInventoryComponent::FindEquipmentSlot(FName ItemID) const
 		// 태그 비교 로직
 		const FGameplayTag& Tag = ArmorRow->ArmorTag;
 
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag("Item.Type.Armor.Helmet"))) return EEquipmentSlot::Helmet;
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag("Item.Type.Armor.Chest")))  return EEquipmentSlot::Chest;
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag("Item.Type.Armor.Gloves"))) return EEquipmentSlot::Gloves;
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag("Item.Type.Armor.Boots")))  return EEquipmentSlot::Boots;
+		const FParadiseGameplayTags& Tags = FParadiseGameplayTags::Get();
+
+		if (Tag.MatchesTag(Tags.Item_Type_Armor_Helmet)) return EEquipmentSlot::Helmet;
+		if (Tag.MatchesTag(Tags.Item_Type_Armor_Chest))  return EEquipmentSlot::Chest;
+		if (Tag.MatchesTag(Tags.Item_Type_Armor_Gloves)) return EEquipmentSlot::Gloves;
+		if (Tag.MatchesTag(Tags.Item_Type_Armor_Boots))  return EEquipmentSlot::Boots;
 
 		// 매칭되는 태그가 없으면 경고
 		UE_LOG(LogTemp, Warning, TEXT("⚠️ [FindSlot] 알 수 없는 방어구 태그: %s"), *Tag.ToString());
@@ -0,0 +1,175 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/MeleeHitDetectionComponent.h"
+#include "GAS/System/ParadiseGameplayTags.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseMelee"), STATGROUP_ParadiseMelee, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Melee Hit Detection"), STAT_Melee_Tick, STATGROUP_ParadiseMelee);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sweeps / Frame"), STAT_Melee_Sweeps, STATGROUP_ParadiseMelee);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits / Frame"), STAT_Melee_Hits, STATGROUP_ParadiseMelee);
+
+static TAutoConsoleVariable<int32> CVarMeleeDebugDraw(
+	TEXT("paradise.melee.DebugDraw"),
+	0,
+	TEXT("1이면 근접 판정 스윕(초록)과 타격 지점(빨강)을 그립니다."),
+	ECVF_Cheat);
+
+UMeleeHitDetectionComponent::UMeleeHitDetectionComponent()
+{
+	// 스윙 중(+결과 대기 한 프레임)에만 틱
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// 애니메이션이 끝난 뒤의 소켓 위치를 써야 하므로 늦게 틱
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UMeleeHitDetectionComponent::BeginSwing(USkeletalMeshComponent* InMesh)
+{
+	if (!InMesh)
+	{
+		const ACharacter* OwnerCharacter = Cast<ACharacter>(GetOwner());
+		InMesh = OwnerCharacter ? OwnerCharacter->GetMesh() : nullptr;
+	}
+	if (!InMesh) return;
+
+	SwingMesh = InMesh;
+	HitThisSwing.Reset();
+	PrevSocketLocation = GetSocketLocation();
+	bIsSwinging = true;
+
+	SetComponentTickEnabled(true);
+}
+
+void UMeleeHitDetectionComponent::EndSwing()
+{
+	// 틱은 남은 결과를 다 받은 뒤 TickComponent에서 끕니다.
+	bIsSwinging = false;
+}
+
+void UMeleeHitDetectionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SCOPE_CYCLE_COUNTER(STAT_Melee_Tick);
+
+	TArray<AActor*> NewHits;
+	ConsumeTraceResults(NewHits);
+
+	if (NewHits.Num() > 0)
+	{
+		SendHitEvent(NewHits);
+	}
+
+	if (bIsSwinging)
+	{
+		IssueSweep();
+	}
+	else if (PendingTraces.IsEmpty())
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UMeleeHitDetectionComponent::ConsumeTraceResults(TArray<AActor*>& OutNewHits)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const bool bDebugDraw = CVarMeleeDebugDraw.GetValueOnGameThread() != 0;
+
+	FTraceDatum Datum;
+	for (int32 Index = PendingTraces.Num() - 1; Index >= 0; --Index)
+	{
+		const FTraceHandle Handle = PendingTraces[Index];
+
+		// 버퍼에서 밀려난 오래된 핸들은 버림, 아직 안 끝난 스윕은 다음 프레임에 다시 확인
+		if (!World->IsTraceHandleValid(Handle, false))
+		{
+			PendingTraces.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+		if (!World->QueryTraceData(Handle, Datum)) continue;
+		PendingTraces.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+		for (const FHitResult& Hit : Datum.OutHits)
+		{
+			AActor* HitActor = Hit.GetActor();
+			// 벽/바닥 같은 지형은 겹쳐도 타격 대상이 아님
+			if (!HitActor || HitActor == GetOwner() || !HitActor->IsA<APawn>()) continue;
+
+			bool bAlreadyHit = false;
+			HitThisSwing.Add(HitActor, &bAlreadyHit);
+			if (bAlreadyHit) continue;
+
+			OutNewHits.Add(HitActor);
+
+			if (bDebugDraw)
+			{
+				DrawDebugPoint(World, Hit.ImpactPoint, 12.0f, FColor::Red, false, 1.0f);
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_Melee_Hits, OutNewHits.Num());
+}
+
+void UMeleeHitDetectionComponent::IssueSweep()
+{
+	UWorld* World = GetWorld();
+	if (!World || !SwingMesh.IsValid()) return;
+
+	const FVector Start = PrevSocketLocation;
+	const FVector End = GetSocketLocation();
+	PrevSocketLocation = End;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MeleeSweep), false, GetOwner());
+
+	// 폰을 막지 않고 겹치기만 하도록 해서, 경로 위의 대상을 전부 받습니다.
+	FCollisionResponseParams ResponseParams;
+	ResponseParams.CollisionResponse.SetAllChannels(ECR_Overlap);
+
+	PendingTraces.Add(World->AsyncSweepByChannel(EAsyncTraceType::Multi,
+		Start, End, FQuat::Identity,
+		TraceChannel, FCollisionShape::MakeSphere(Radius), QueryParams, ResponseParams));
+
+	INC_DWORD_STAT(STAT_Melee_Sweeps);
+
+	if (CVarMeleeDebugDraw.GetValueOnGameThread() != 0)
+	{
+		const FVector Segment = End - Start;
+		const FQuat Rotation = Segment.IsNearlyZero() ? FQuat::Identity : FRotationMatrix::MakeFromZ(Segment).ToQuat();
+		DrawDebugCapsule(World, (Start + End) * 0.5f, Segment.Size() * 0.5f + Radius, Radius, Rotation, FColor::Green, false, 1.0f);
+	}
+}
+
+void UMeleeHitDetectionComponent::SendHitEvent(const TArray<AActor*>& NewHits) const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner) return;
+
+	// MeleeBase가 기다리는 태그 하나로, 이번 프레임 대상 전부를 묶어서 전달
+	FGameplayEventData Payload;
+	Payload.Instigator = Owner;
+	Payload.Target = NewHits[0];
+	Payload.TargetData = UAbilitySystemBlueprintLibrary::AbilityTargetDataFromActorArray(NewHits, false);
+
+	UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(Owner, FParadiseGameplayTags::Get().Event_Montage_Hit, Payload);
+
+	// 타격마다 찍히므로 평소에는 숨김 (log LogTemp Verbose 로 확인)
+	UE_LOG(LogTemp, Verbose, TEXT("👊 [MeleeHit] 타격 %d명 (첫 대상: %s)"), NewHits.Num(), *NewHits[0]->GetName());
+}
+
+FVector UMeleeHitDetectionComponent::GetSocketLocation() const
+{
+	return SwingMesh.IsValid() ? SwingMesh->GetSocketLocation(SocketName) : FVector::ZeroVector;
+}
@@ -0,0 +1,187 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/SquadAIControllerComponent.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GSquadSwapStatsCommand(
+	TEXT("paradise.squad.swapstats"),
+	TEXT("영웅 교체(빙의 전환) 소요 시간 통계를 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		if (const USquadAIControllerComponent* SquadAI = PC ? PC->FindComponentByClass<USquadAIControllerComponent>() : nullptr)
+		{
+			SquadAI->DumpSwapStats();
+		}
+	}));
+
+USquadAIControllerComponent::USquadAIControllerComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void USquadAIControllerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// 슬롯 컨트롤러는 이 컴포넌트가 소유하므로 함께 정리
+	for (AAIController* SlotController : SlotControllers)
+	{
+		if (IsValid(SlotController))
+		{
+			SlotController->Destroy();
+		}
+	}
+	SlotControllers.Reset();
+	SlotLastPawns.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USquadAIControllerComponent::HandOffToAI(int32 SlotIndex, APawn* Pawn, TSubclassOf<AAIController> ControllerClass)
+{
+	if (!Pawn || SlotIndex < 0) return;
+
+	AAIController* SlotController = GetOrCreateSlotController(SlotIndex, Pawn, ControllerClass);
+	if (!SlotController) return;
+
+	AController* CurrentController = Pawn->GetController();
+	if (CurrentController == SlotController) return;
+
+	if (CurrentController)
+	{
+		//플레이어가 조종 중이면 건드리지 않음 (TakeFromAI 이후 플레이어가 직접 빙의를 넘겨야 함)
+		if (CurrentController->IsPlayerController()) return;
+
+		//스폰 시 자동 생성된 기본 AI 컨트롤러 등 슬롯 밖의 컨트롤러는 1회 정리
+		CurrentController->UnPossess();
+		CurrentController->Destroy();
+	}
+
+	const bool bSamePawn = SlotLastPawns[SlotIndex].Get() == Pawn;
+	UBrainComponent* Brain = SlotController->GetBrainComponent();
+	const bool bWasPaused = Brain && Brain->IsPaused();
+
+	SlotController->Possess(Pawn);
+	SlotLastPawns[SlotIndex] = Pawn;
+
+	Brain = SlotController->GetBrainComponent();
+	if (bWasPaused)
+	{
+		//멈췄던 지점부터 재개 (부활 등으로 육체가 바뀌었으면 처음부터)
+		Brain->ResumeLogic(TEXT("Squad hand-off"));
+		if (!bSamePawn)
+		{
+			Brain->RestartLogic();
+		}
+	}
+	else if ((!Brain || !Brain->IsRunning()) && SquadBehaviorTree)
+	{
+		SlotController->RunBehaviorTree(SquadBehaviorTree);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("🤖 [SquadAI] 슬롯 %d 컨트롤러가 %s 조종 (%s)"),
+		SlotIndex, *Pawn->GetName(), bWasPaused ? (bSamePawn ? TEXT("재개") : TEXT("재시작")) : TEXT("시작"));
+}
+
+void USquadAIControllerComponent::TakeFromAI(int32 SlotIndex, APawn* Pawn)
+{
+	AAIController* SlotController = GetSlotController(SlotIndex);
+
+	if (!Pawn && SlotLastPawns.IsValidIndex(SlotIndex))
+	{
+		Pawn = SlotLastPawns[SlotIndex].Get();
+	}
+
+	//아직 슬롯에 넘어간 적 없는 육체의 자동 생성 AI 컨트롤러는 HandOffToAI와 같이 정리
+	AAIController* CurrentAI = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+	if (CurrentAI && CurrentAI != SlotController)
+	{
+		CurrentAI->UnPossess();
+		CurrentAI->Destroy();
+	}
+
+	if (!SlotController || !SlotController->GetPawn()) return;
+
+	//블랙보드/노드 메모리는 유지한 채 멈춤
+	if (UBrainComponent* Brain = SlotController->GetBrainComponent())
+	{
+		Brain->PauseLogic(TEXT("Player took control"));
+	}
+	SlotController->StopMovement();
+	SlotController->UnPossess();
+}
+
+AAIController* USquadAIControllerComponent::GetSlotController(int32 SlotIndex) const
+{
+	return SlotControllers.IsValidIndex(SlotIndex) ? SlotControllers[SlotIndex].Get() : nullptr;
+}
+
+AAIController* USquadAIControllerComponent::GetOrCreateSlotController(int32 SlotIndex, APawn* Pawn, TSubclassOf<AAIController> ControllerClass)
+{
+	if (SlotIndex >= SlotControllers.Num())
+	{
+		SlotControllers.SetNum(SlotIndex + 1);
+		SlotLastPawns.SetNum(SlotIndex + 1);
+	}
+
+	if (IsValid(SlotControllers[SlotIndex])) return SlotControllers[SlotIndex];
+	if (!ControllerClass) return nullptr;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	//슬롯당 1회만 생성 (이후 교체 시에는 빙의만 주고받음)
+	AAIController* NewController = GetWorld()->SpawnActor<AAIController>(
+		ControllerClass,
+		Pawn->GetActorLocation(),
+		Pawn->GetActorRotation(),
+		SpawnParams
+	);
+	if (!NewController) return nullptr;
+
+	//빙의 해제 시 BT를 정리하지 않고, 재빙의 시 자동 시작하지 않음 (재개 여부는 이 컴포넌트가 결정)
+	NewController->bStopAILogicOnUnposses = false;
+	NewController->bStartAILogicOnPossess = false;
+	NewController->OnPossessedPawnChanged.AddDynamic(this, &USquadAIControllerComponent::HandleSlotPawnChanged);
+
+	SlotControllers[SlotIndex] = NewController;
+	SlotLastPawns[SlotIndex] = nullptr;
+	return NewController;
+}
+
+void USquadAIControllerComponent::HandleSlotPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+	if (NewPawn) return;
+
+	//사망(CharacterBase::Die)으로 빙의가 풀린 경우: 육체 없이 BT가 돌지 않도록 멈춤
+	for (AAIController* SlotController : SlotControllers)
+	{
+		if (!IsValid(SlotController) || SlotController->GetPawn()) continue;
+
+		UBrainComponent* Brain = SlotController->GetBrainComponent();
+		if (Brain && Brain->IsRunning() && !Brain->IsPaused())
+		{
+			Brain->PauseLogic(TEXT("Lost pawn"));
+		}
+	}
+}
+
+void USquadAIControllerComponent::RecordSwap(double SwapMs)
+{
+	const float Ms = static_cast<float>(SwapMs);
+	++SwapStats.SwapCount;
+	SwapStats.LastSwapMs = Ms;
+	SwapStats.MaxSwapMs = FMath::Max(SwapStats.MaxSwapMs, Ms);
+	SwapStats.TotalSwapMs += Ms;
+}
+
+void USquadAIControllerComponent::DumpSwapStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("===== [SquadAI] 교체 통계: %d회 | 평균 %.3f ms | 최대 %.3f ms | 마지막 %.3f ms | 슬롯 컨트롤러 %d개 ====="),
+		SwapStats.SwapCount, SwapStats.GetAverageMs(), SwapStats.MaxSwapMs, SwapStats.LastSwapMs, SlotControllers.Num());
+}
@@ -0,0 +1,469 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/Core/ParadiseCombatSimCommandlet.h"
+#include "GAS/Calculations/CombatFormula.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Csv/CsvParser.h"
+
+namespace ParadiseCombatSim
+{
+	/** @brief CSV 한 장 (첫 줄 = 헤더, 첫 열 = 행 이름) */
+	struct FTable
+	{
+		TMap<FString, int32> ColumnIndex;
+		TArray<TArray<FString>> Rows;
+
+		FString GetString(const TArray<FString>& Row, const TCHAR* Column) const
+		{
+			const int32* Index = ColumnIndex.Find(Column);
+			return Index && Row.IsValidIndex(*Index) ? Row[*Index] : FString();
+		}
+
+		float GetFloat(const TArray<FString>& Row, const TCHAR* Column, float Default = 0.f) const
+		{
+			const FString Value = GetString(Row, Column);
+			return Value.IsEmpty() ? Default : FCString::Atof(*Value);
+		}
+
+		const TArray<FString>* FindRow(const FString& RowName) const
+		{
+			return Rows.FindByPredicate([&RowName](const TArray<FString>& Row) { return Row[0] == RowName; });
+		}
+	};
+
+	/** @brief 전투 한 쪽의 스탯 (런타임 어트리뷰트와 같은 의미) */
+	struct FFighter
+	{
+		float MaxHP = 1.f;
+		float AttackPower = 0.f;
+		float Defense = 0.f;
+		float CritRate = 0.f;
+		float CritDamage = ParadiseCombat::DefaultCritDamage;
+		float AttackInterval = 1.f;
+	};
+
+	/** @brief 영웅 + 무기 + 방어구 세트 조합 */
+	struct FLoadout
+	{
+		FString Hero;
+		FString Weapon;
+		FString Armor;
+		FFighter Stats;
+	};
+
+	struct FEnemy
+	{
+		FString Name;
+		FFighter Stats;
+	};
+
+	struct FSettings
+	{
+		int32 Fights = 10000;
+		int32 Seed = 1;
+		int32 Level = 1;
+		float Multiplier = 1.f;
+		float TimeCap = 600.f;
+	};
+
+	/** @brief 조합 하나의 집계 (TTK는 이긴 판만) */
+	struct FComboResult
+	{
+		float WinRate = 0.f;
+		float MeanTTK = 0.f;
+		float P50TTK = 0.f;
+		float P95TTK = 0.f;
+		float MeanDPS = 0.f;
+		float ExpectedDPS = 0.f;
+		float MeanHPLeftRatio = 0.f;
+	};
+
+	struct FFightOutcome
+	{
+		bool bWin = false;
+		float Time = 0.f;
+		float DamageDealt = 0.f;
+		float HeroHP = 0.f;
+	};
+
+	static bool LoadTable(const FString& Directory, const TCHAR* Name, FTable& OutTable)
+	{
+		const FString Path = FPaths::Combine(Directory, FString(Name) + TEXT(".csv"));
+
+		FString Content;
+		if (!FFileHelper::LoadFileToString(Content, *Path))
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ [CombatSim] CSV를 읽지 못했습니다: %s"), *Path);
+			return false;
+		}
+
+		const FCsvParser Parser(MoveTemp(Content));
+		const FCsvParser::FRows& Rows = Parser.GetRows();
+		if (Rows.IsEmpty()) return false;
+
+		for (int32 Column = 0; Column < Rows[0].Num(); ++Column)
+		{
+			OutTable.ColumnIndex.Add(FString(Rows[0][Column]).TrimStartAndEnd(), Column);
+		}
+
+		for (int32 RowIndex = 1; RowIndex < Rows.Num(); ++RowIndex)
+		{
+			// 빈 줄 / 이름 없는 줄은 건너뜀
+			if (Rows[RowIndex].IsEmpty() || FCString::Strlen(Rows[RowIndex][0]) == 0) continue;
+
+			TArray<FString>& Row = OutTable.Rows.AddDefaulted_GetRef();
+			for (const TCHAR* Cell : Rows[RowIndex])
+			{
+				Row.Add(FString(Cell).TrimStartAndEnd());
+			}
+		}
+		return true;
+	}
+
+	/** @brief 세트 효과 한 줄을 스탯에 더합니다. (평탄 합산, 이동속도/마나처럼 전투 결과와 무관한 스탯은 무시) */
+	static void ApplySetStat(FFighter& Stats, const FString& StatTag, float Value)
+	{
+		if (StatTag == TEXT("SetBonus.Stat.AttackPower")) Stats.AttackPower += Value;
+		else if (StatTag == TEXT("SetBonus.Stat.Defense")) Stats.Defense += Value;
+		else if (StatTag == TEXT("SetBonus.Stat.MaxHP")) Stats.MaxHP += Value;
+		else if (StatTag == TEXT("SetBonus.Stat.CritRate")) Stats.CritRate += Value;
+		else if (StatTag == TEXT("SetBonus.Stat.AttackSpeed")) Stats.AttackInterval = 1.f / FMath::Max(1.f / Stats.AttackInterval + Value, 0.1f);
+	}
+
+	/**
+	 * @brief 방어구를 세트 단위로 묶습니다.
+	 * @details 없음 1개 + SetID별 1개(부위당 첫 행) + SetID 없는 방어구 각각 1개
+	 */
+	static TArray<TPair<FString, TArray<int32>>> BuildArmorGroups(const FTable& Armors)
+	{
+		TArray<TPair<FString, TArray<int32>>> Groups;
+		Groups.Emplace(TEXT("None"), TArray<int32>());
+
+		TMap<FString, int32> GroupBySet;
+		TSet<FString> FilledSlots;
+
+		for (int32 RowIndex = 0; RowIndex < Armors.Rows.Num(); ++RowIndex)
+		{
+			const TArray<FString>& Row = Armors.Rows[RowIndex];
+			const FString SetID = Armors.GetString(Row, TEXT("SetID"));
+
+			if (SetID.IsEmpty() || SetID == TEXT("None"))
+			{
+				Groups.Emplace(Row[0], TArray<int32>({ RowIndex }));
+				continue;
+			}
+
+			// 같은 세트에서 같은 부위가 또 나오면 첫 행만 사용
+			const FString SlotKey = SetID + TEXT("|") + Armors.GetString(Row, TEXT("ArmorTag"));
+			if (FilledSlots.Contains(SlotKey)) continue;
+			FilledSlots.Add(SlotKey);
+
+			int32& GroupIndex = GroupBySet.FindOrAdd(SetID, INDEX_NONE);
+			if (GroupIndex == INDEX_NONE)
+			{
+				GroupIndex = Groups.Emplace(SetID, TArray<int32>());
+			}
+			Groups[GroupIndex].Value.Add(RowIndex);
+		}
+		return Groups;
+	}
+
+	static TArray<FLoadout> BuildLoadouts(const FTable& Characters, const FTable& Weapons, const FTable& Armors, const FTable& SetBonuses, int32 Level)
+	{
+		const TArray<TPair<FString, TArray<int32>>> ArmorGroups = BuildArmorGroups(Armors);
+		const float LevelsGained = FMath::Max(Level - 1, 0);
+
+		TArray<FLoadout> Loadouts;
+		Loadouts.Reserve(Characters.Rows.Num() * Weapons.Rows.Num() * ArmorGroups.Num());
+
+		for (const TArray<FString>& Character : Characters.Rows)
+		{
+			for (const TArray<FString>& Weapon : Weapons.Rows)
+			{
+				for (const TPair<FString, TArray<int32>>& ArmorGroup : ArmorGroups)
+				{
+					FLoadout& Loadout = Loadouts.AddDefaulted_GetRef();
+					Loadout.Hero = Character[0];
+					Loadout.Weapon = Weapon[0];
+					Loadout.Armor = ArmorGroup.Key;
+
+					// 캐릭터 기본값 + 레벨 성장 (PlayerData::InitCombatAttributes와 같은 컬럼)
+					FFighter& Stats = Loadout.Stats;
+					Stats.MaxHP = Characters.GetFloat(Character, TEXT("BaseMaxHP"), 1.f) + Characters.GetFloat(Character, TEXT("GrowthHPPerLevel")) * LevelsGained;
+					Stats.AttackPower = Characters.GetFloat(Character, TEXT("BaseAttackPower")) + Characters.GetFloat(Character, TEXT("GrowthAttackPerLevel")) * LevelsGained;
+					Stats.Defense = Characters.GetFloat(Character, TEXT("BaseDefense")) + Characters.GetFloat(Character, TEXT("GrowthDefensePerLevel")) * LevelsGained;
+					Stats.CritRate = Characters.GetFloat(Character, TEXT("BaseCritRate"));
+
+					// 무기
+					Stats.AttackPower += Weapons.GetFloat(Weapon, TEXT("AttackPower"));
+					Stats.CritRate += Weapons.GetFloat(Weapon, TEXT("CritRate"));
+					Stats.CritDamage = Weapons.GetFloat(Weapon, TEXT("CritDamage"), ParadiseCombat::DefaultCritDamage);
+					Stats.AttackInterval = 1.f / FMath::Max(Weapons.GetFloat(Weapon, TEXT("AttackSpeed"), 1.f), 0.1f);
+
+					TMap<FString, int32> SetPieces;
+					const FString WeaponSetID = Weapons.GetString(Weapon, TEXT("SetID"));
+					if (!WeaponSetID.IsEmpty()) ++SetPieces.FindOrAdd(WeaponSetID);
+
+					// 방어구
+					for (const int32 ArmorIndex : ArmorGroup.Value)
+					{
+						const TArray<FString>& Armor = Armors.Rows[ArmorIndex];
+						Stats.Defense += Armors.GetFloat(Armor, TEXT("DefensePower"));
+						Stats.MaxHP += Armors.GetFloat(Armor, TEXT("MaxHP"));
+
+						const FString ArmorSetID = Armors.GetString(Armor, TEXT("SetID"));
+						if (!ArmorSetID.IsEmpty()) ++SetPieces.FindOrAdd(ArmorSetID);
+					}
+
+					// 세트 효과 (Slot3은 적용 스탯 컬럼이 없어 제외)
+					for (const TPair<FString, int32>& SetPiece : SetPieces)
+					{
+						const TArray<FString>* SetBonus = SetBonuses.FindRow(SetPiece.Key);
+						if (!SetBonus) continue;
+
+						if (SetPiece.Value >= SetBonuses.GetFloat(*SetBonus, TEXT("Slot1_Count"), 2.f))
+						{
+							ApplySetStat(Stats, SetBonuses.GetString(*SetBonus, TEXT("Slot1_AttributeTag")), SetBonuses.GetFloat(*SetBonus, TEXT("Slot1_Value")));
+						}
+						if (SetPiece.Value >= SetBonuses.GetFloat(*SetBonus, TEXT("Slot2_Count"), 3.f))
+						{
+							ApplySetStat(Stats, SetBonuses.GetString(*SetBonus, TEXT("Slot2_AttributeTag")), SetBonuses.GetFloat(*SetBonus, TEXT("Slot2_Value")));
+						}
+					}
+				}
+			}
+		}
+		return Loadouts;
+	}
+
+	static TArray<FEnemy> BuildEnemies(const FTable& Enemies)
+	{
+		TArray<FEnemy> Result;
+		for (const TArray<FString>& Row : Enemies.Rows)
+		{
+			// ABaseUnit::InitializeUnit과 같은 컬럼 (치명타 피해는 데미지 큐 기본값)
+			FEnemy& Enemy = Result.AddDefaulted_GetRef();
+			Enemy.Name = Row[0];
+			Enemy.Stats.MaxHP = Enemies.GetFloat(Row, TEXT("BaseMaxHP"), 1.f);
+			Enemy.Stats.AttackPower = Enemies.GetFloat(Row, TEXT("BaseAttackPower"));
+			Enemy.Stats.Defense = Enemies.GetFloat(Row, TEXT("BaseDefense"));
+			Enemy.Stats.CritRate = Enemies.GetFloat(Row, TEXT("BaseCritRate"));
+			Enemy.Stats.AttackInterval = FMath::Max(Enemies.GetFloat(Row, TEXT("AttackInterval"), 1.f), 0.1f);
+		}
+		return Result;
+	}
+
+	/** @brief 한 방 (런타임 ExecCalcCombat / 데미지 큐와 같은 공식) */
+	static float RollHit(const FFighter& Attacker, const FFighter& Defender, float Multiplier, FRandomStream& Random)
+	{
+		const bool bCritical = ParadiseCombat::RollCritical(Attacker.CritRate, Random.GetFraction());
+		return ParadiseCombat::ComputeDamage(Attacker.AttackPower, Multiplier, Defender.Defense, bCritical, Attacker.CritDamage);
+	}
+
+	/** @brief 1:1 전투 한 판. 양쪽 모두 공격 간격마다 한 방씩, 같은 시각이면 영웅이 먼저 칩니다. */
+	static FFightOutcome SimulateFight(const FFighter& Hero, const FFighter& Enemy, const FSettings& Settings, FRandomStream& Random)
+	{
+		FFightOutcome Outcome;
+		float HeroHP = Hero.MaxHP;
+		float EnemyHP = Enemy.MaxHP;
+		float HeroNext = Hero.AttackInterval;
+		float EnemyNext = Enemy.AttackInterval;
+
+		while (true)
+		{
+			const float Now = FMath::Min(HeroNext, EnemyNext);
+			if (Now > Settings.TimeCap)
+			{
+				Outcome.Time = Settings.TimeCap;
+				break;
+			}
+			Outcome.Time = Now;
+
+			if (HeroNext <= EnemyNext)
+			{
+				const float Damage = RollHit(Hero, Enemy, Settings.Multiplier, Random);
+				Outcome.DamageDealt += FMath::Min(Damage, EnemyHP);
+				EnemyHP -= Damage;
+				if (EnemyHP <= 0.f)
+				{
+					Outcome.bWin = true;
+					break;
+				}
+				HeroNext += Hero.AttackInterval;
+			}
+			else
+			{
+				HeroHP -= RollHit(Enemy, Hero, 1.f, Random);
+				if (HeroHP <= 0.f) break;
+				EnemyNext += Enemy.AttackInterval;
+			}
+		}
+
+		Outcome.HeroHP = FMath::Max(HeroHP, 0.f);
+		return Outcome;
+	}
+
+	static FComboResult SimulateCombo(const FFighter& Hero, const FFighter& Enemy, const FSettings& Settings, FRandomStream& Random)
+	{
+		FComboResult Result;
+
+		TArray<float> WinTimes;
+		WinTimes.Reserve(Settings.Fights);
+
+		double TotalDPS = 0.0;
+		double TotalHPLeft = 0.0;
+
+		for (int32 Fight = 0; Fight < Settings.Fights; ++Fight)
+		{
+			const FFightOutcome Outcome = SimulateFight(Hero, Enemy, Settings, Random);
+			if (Outcome.bWin)
+			{
+				WinTimes.Add(Outcome.Time);
+			}
+			TotalDPS += Outcome.Time > 0.f ? Outcome.DamageDealt / Outcome.Time : 0.f;
+			TotalHPLeft += Outcome.HeroHP / Hero.MaxHP;
+		}
+
+		Result.WinRate = static_cast<float>(WinTimes.Num()) / Settings.Fights;
+		Result.MeanDPS = static_cast<float>(TotalDPS / Settings.Fights);
+		Result.MeanHPLeftRatio = static_cast<float>(TotalHPLeft / Settings.Fights);
+
+		// 기대 DPS (치명타 확률로 가중한 한 방 / 공격 간격) - 시뮬레이션 값 검산용
+		const float CritChance = FMath::Clamp(Hero.CritRate, 0.f, 1.f);
+		const float NormalHit = ParadiseCombat::ComputeDamage(Hero.AttackPower, Settings.Multiplier, Enemy.Defense, false, Hero.CritDamage);
+		const float CriticalHit = ParadiseCombat::ComputeDamage(Hero.AttackPower, Settings.Multiplier, Enemy.Defense, true, Hero.CritDamage);
+		Result.ExpectedDPS = FMath::Lerp(NormalHit, CriticalHit, CritChance) / Hero.AttackInterval;
+
+		if (WinTimes.Num() > 0)
+		{
+			WinTimes.Sort();
+
+			double TotalTime = 0.0;
+			for (const float Time : WinTimes)
+			{
+				TotalTime += Time;
+			}
+			Result.MeanTTK = static_cast<float>(TotalTime / WinTimes.Num());
+			Result.P50TTK = WinTimes[(WinTimes.Num() - 1) / 2];
+			Result.P95TTK = WinTimes[FMath::FloorToInt((WinTimes.Num() - 1) * 0.95f)];
+		}
+		return Result;
+	}
+}
+
+UParadiseCombatSimCommandlet::UParadiseCombatSimCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UParadiseCombatSimCommandlet::Main(const FString& Params)
+{
+	using namespace ParadiseCombatSim;
+
+	// 1. 옵션
+	FSettings Settings;
+	FParse::Value(*Params, TEXT("Fights="), Settings.Fights);
+	FParse::Value(*Params, TEXT("Seed="), Settings.Seed);
+	FParse::Value(*Params, TEXT("Level="), Settings.Level);
+	FParse::Value(*Params, TEXT("Multiplier="), Settings.Multiplier);
+	FParse::Value(*Params, TEXT("TimeCap="), Settings.TimeCap);
+	Settings.Fights = FMath::Max(Settings.Fights, 1);
+	Settings.TimeCap = FMath::Max(Settings.TimeCap, 1.f);
+
+	FString InputDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("DesignData/CSVs_Export"));
+	FParse::Value(*Params, TEXT("Input="), InputDir);
+
+	FString OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CombatSim"));
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	// 2. 기획 데이터
+	FTable Characters, Weapons, Armors, SetBonuses, Enemies, Stages;
+	if (!LoadTable(InputDir, TEXT("CharacterStats"), Characters)
+		|| !LoadTable(InputDir, TEXT("WeaponStats"), Weapons)
+		|| !LoadTable(InputDir, TEXT("ArmorStats"), Armors)
+		|| !LoadTable(InputDir, TEXT("SetBonusStats"), SetBonuses)
+		|| !LoadTable(InputDir, TEXT("EnemyStats"), Enemies)
+		|| !LoadTable(InputDir, TEXT("StageStats"), Stages))
+	{
+		return 1;
+	}
+
+	const TArray<FLoadout> Loadouts = BuildLoadouts(Characters, Weapons, Armors, SetBonuses, Settings.Level);
+	const TArray<FEnemy> EnemyList = BuildEnemies(Enemies);
+
+	if (Loadouts.IsEmpty() || EnemyList.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [CombatSim] 영웅/무기 또는 적 데이터가 비어 있습니다. (%s)"), *InputDir);
+		return 1;
+	}
+
+	// 3. 전 조합 시뮬레이션 (조합마다 시드에서 파생한 스트림 → 스레드 수와 무관하게 같은 결과)
+	const int32 NumEnemies = EnemyList.Num();
+	const int32 NumCombos = Loadouts.Num() * NumEnemies;
+
+	TArray<FComboResult> Results;
+	Results.SetNum(NumCombos);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(NumCombos, [&](int32 ComboIndex)
+	{
+		FRandomStream Random(static_cast<int32>(HashCombine(GetTypeHash(Settings.Seed), GetTypeHash(ComboIndex))));
+		Results[ComboIndex] = SimulateCombo(Loadouts[ComboIndex / NumEnemies].Stats, EnemyList[ComboIndex % NumEnemies].Stats, Settings, Random);
+	});
+
+	const double Elapsed = FPlatformTime::Seconds() - StartTime;
+	const int64 TotalFights = static_cast<int64>(NumCombos) * Settings.Fights;
+
+	// 4. 결과 CSV
+	FString TTKCsv = TEXT("Hero,Weapon,Armor,Enemy,HeroMaxHP,HeroAttackPower,HeroDefense,HeroCritRate,HeroAttackInterval,Fights,WinRate,MeanTTK,P50TTK,P95TTK,MeanDPS,ExpectedDPS,MeanHPLeftRatio\n");
+	FString StageCsv = TEXT("Stage,TimeLimit,Hero,Weapon,Armor,Enemy,WinRate,MeanTTK,KillsInTimeLimit\n");
+
+	for (int32 ComboIndex = 0; ComboIndex < NumCombos; ++ComboIndex)
+	{
+		const FLoadout& Loadout = Loadouts[ComboIndex / NumEnemies];
+		const FEnemy& Enemy = EnemyList[ComboIndex % NumEnemies];
+		const FComboResult& Result = Results[ComboIndex];
+		const FFighter& Hero = Loadout.Stats;
+
+		TTKCsv += FString::Printf(TEXT("%s,%s,%s,%s,%.1f,%.1f,%.1f,%.3f,%.3f,%d,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f\n"),
+			*Loadout.Hero, *Loadout.Weapon, *Loadout.Armor, *Enemy.Name,
+			Hero.MaxHP, Hero.AttackPower, Hero.Defense, Hero.CritRate, Hero.AttackInterval,
+			Settings.Fights, Result.WinRate, Result.MeanTTK, Result.P50TTK, Result.P95TTK,
+			Result.MeanDPS, Result.ExpectedDPS, Result.MeanHPLeftRatio);
+
+		// 스테이지 제한 시간 안에 같은 적을 몇 마리 잡는지 (TTK 기준, 이동/대기 시간 제외)
+		for (const TArray<FString>& Stage : Stages.Rows)
+		{
+			const float TimeLimit = Stages.GetFloat(Stage, TEXT("TimeLimit"));
+			const int32 Kills = Result.MeanTTK > 0.f ? FMath::FloorToInt(TimeLimit / Result.MeanTTK) : 0;
+
+			StageCsv += FString::Printf(TEXT("%s,%.1f,%s,%s,%s,%s,%.4f,%.3f,%d\n"),
+				*Stage[0], TimeLimit, *Loadout.Hero, *Loadout.Weapon, *Loadout.Armor, *Enemy.Name,
+				Result.WinRate, Result.MeanTTK, Kills);
+		}
+	}
+
+	const FString TTKPath = FPaths::Combine(OutputDir, TEXT("CombatSim_TTK.csv"));
+	const FString StagePath = FPaths::Combine(OutputDir, TEXT("CombatSim_Stage.csv"));
+
+	if (!FFileHelper::SaveStringToFile(TTKCsv, *TTKPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+		|| !FFileHelper::SaveStringToFile(StageCsv, *StagePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [CombatSim] 결과를 저장하지 못했습니다: %s"), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("✅ [CombatSim] 조합 %d개 x %d판 = %lld판, %.2f초 (%.0f판/초, 시드 %d)"),
+		NumCombos, Settings.Fights, TotalFights, Elapsed, Elapsed > 0.0 ? TotalFights / Elapsed : 0.0, Settings.Seed);
+	UE_LOG(LogTemp, Log, TEXT("✅ [CombatSim] 저장: %s, %s"), *TTKPath, *StagePath);
+	return 0;
+}
@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/Core/ParadiseTagAuditCommandlet.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ParadiseTagAudit
+{
+	/** @brief 네이티브 태그 등록 파일 (유일하게 허용) */
+	static const TCHAR* RegistrationFile = TEXT("ParadiseGameplayTags.cpp");
+
+	/** @brief 찾을 호출 (이 파일 자체가 걸리지 않도록 나눠 씀) */
+	static const TCHAR* Forbidden = TEXT("Request") TEXT("GameplayTag");
+
+	static bool IsCommentLine(const FString& Trimmed)
+	{
+		return Trimmed.StartsWith(TEXT("//")) || Trimmed.StartsWith(TEXT("/*")) || Trimmed.StartsWith(TEXT("*"));
+	}
+}
+
+UParadiseTagAuditCommandlet::UParadiseTagAuditCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UParadiseTagAuditCommandlet::Main(const FString& Params)
+{
+	const FString SourceDir = FPaths::Combine(FPaths::GameSourceDir(), TEXT("Paradise"));
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.cpp"), true, false);
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.h"), true, false, false);
+
+	if (Files.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [TagAudit] 소스 폴더를 찾지 못했습니다: %s"), *SourceDir);
+		return 1;
+	}
+
+	int32 Violations = 0;
+	TArray<FString> Lines;
+
+	for (const FString& File : Files)
+	{
+		if (FPaths::GetCleanFilename(File) == ParadiseTagAudit::RegistrationFile) continue;
+
+		Lines.Reset();
+		if (!FFileHelper::LoadFileToStringArray(Lines, *File)) continue;
+
+		for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			const FString Trimmed = Lines[LineIndex].TrimStartAndEnd();
+			if (ParadiseTagAudit::IsCommentLine(Trimmed) || !Trimmed.Contains(ParadiseTagAudit::Forbidden)) continue;
+
+			++Violations;
+			UE_LOG(LogTemp, Error, TEXT("❌ [TagAudit] %s(%d): %s"), *File, LineIndex + 1, *Trimmed);
+		}
+	}
+
+	if (Violations > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [TagAudit] 문자열 태그 조회 %d곳. FParadiseGameplayTags에 등록해서 사용하세요."), Violations);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("✅ [TagAudit] 파일 %d개 검사 완료, 문자열 태그 조회 없음"), Files.Num());
+	return 0;
+}
@@ -7,12 +7,18 @@
 #include "EnhancedInputComponent.h"
 #include "InputMappingContext.h"
 #include "AIController.h"
+#include "Components/SquadAIControllerComponent.h"
 #include "Characters/Base/PlayerBase.h"
 #include "Characters/Player/PlayerData.h"
 #include "Kismet/GameplayStatics.h"
 #include "UI/HUD/Ingame/InGameHUDWidget.h"
 #include "Blueprint/UserWidget.h"
 
+AInGameController::AInGameController()
+{
+    SquadAIManager = CreateDefaultSubobject<USquadAIControllerComponent>(TEXT("SquadAIManager"));
+}
+
 void AInGameController::BeginPlay()
 {
 	Super::BeginPlay();
@@ -129,34 +135,38 @@ void AInGameController::RequestSwitchPlayer(int32 PlayerIndex)
     if (NewPlayer && NewPlayer->IsDead()) return;
 
 
-    //요청된 캐릭터에 AI가 붙어있었다면 제거
-    if (AController* NewPawnController = NewPlayer->GetController())
+    //교체 소요 시간 측정 시작 (빙의 전환 구간)
+    const uint64 SwapStartCycles = FPlatformTime::Cycles64();
+
+    //요청된 캐릭터의 슬롯 AI는 BT를 멈추고 빙의만 해제 (컨트롤러는 유지)
+    if (SquadAIManager)
     {
-        // AI 컨트롤러라면 제거
-        if (NewPawnController != this)
-        {
-            NewPawnController->UnPossess();
-            NewPawnController->Destroy();
-        }
+        SquadAIManager->TakeFromAI(PlayerIndex, NewPlayer);
     }
 
     //요청된 캐릭터로 빙의
     Possess(NewPlayer);
     CurrentControlledIndex = PlayerIndex;
 
-    //이전캐릭터에 AI 주입
+    //이전캐릭터에 AI 주입 (멈춰 있던 BT 재개)
     if (OldPlayer)
     {
         PossessAI(OldPlayer);
     }
 
+    const double SwapMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SwapStartCycles);
+    if (SquadAIManager)
+    {
+        SquadAIManager->RecordSwap(SwapMs);
+    }
+
     // 로그
-    FString Msg = FString::Printf(TEXT("Switch -> Hero %d"), PlayerIndex + 1);
+    FString Msg = FString::Printf(TEXT("Switch -> Hero %d (%.2f ms)"), PlayerIndex + 1, SwapMs);
     GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Cyan, Msg);
 
-    UE_LOG(LogTemp, Warning, TEXT("🔄 [Controller] 캐릭터 교체 완료 (%s -> %s)"),
+    UE_LOG(LogTemp, Warning, TEXT("🔄 [Controller] 캐릭터 교체 완료 (%s -> %s, %.3f ms)"),
         OldPlayer ? *OldPlayer->GetName() : TEXT("None"), // <-- 수정됨
-        *NewPlayer->GetName());
+        *NewPlayer->GetName(), SwapMs);
         
     UpdateCameraSystem();
 }
@@ -415,36 +425,16 @@ void AInGameController::InitializeSquadPawns()
 
 void AInGameController::PossessAI(APlayerBase* TargetCharacter)
 {
-    if (!TargetCharacter || !SquadAIControllerClass) return;
-
-    //기존 컨트롤러 정리
-    if (AController* OldCon = TargetCharacter->GetController())
-    {
-        //만약 (PlayerController)라면 건드리지 않음
-        if (OldCon == this) return;
-
-        OldCon->UnPossess();
-        OldCon->Destroy(); // 기존 AI 삭제
-    }
+    if (!TargetCharacter || !SquadAIControllerClass || !SquadAIManager) return;
 
-    //AI 컨트롤러 스폰
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    //만약 (PlayerController)라면 건드리지 않음
+    if (TargetCharacter->GetController() == this) return;
 
-    //많은 양의 스폰액터가 아니기때문에 오브젝트 풀링 미적용예정
-    AAIController* NewAI = GetWorld()->SpawnActor<AAIController>(
-        SquadAIControllerClass,
-        TargetCharacter->GetActorLocation(),
-        TargetCharacter->GetActorRotation(),
-        SpawnParams
-    );
+    const int32 SlotIndex = ActiveSquadPawns.IndexOfByKey(TargetCharacter);
+    if (SlotIndex == INDEX_NONE) return;
 
-    if (NewAI)
-    {
-        //빙의 (OnPossess가 호출되면서 비헤이비어 트리가 실행됨)
-        NewAI->Possess(TargetCharacter);
-        UE_LOG(LogTemp, Log, TEXT("🤖 [AI] %s에게 AI 컨트롤러가 빙의했습니다."), *TargetCharacter->GetName());
-    }
+    //슬롯 AI 컨트롤러에게 빙의 위임 (슬롯당 최초 1회만 스폰, 이후 재사용)
+    SquadAIManager->HandOffToAI(SlotIndex, TargetCharacter, SquadAIControllerClass);
 }
 
 void AInGameController::OnInputSwitchHero1(const FInputActionValue& Value)
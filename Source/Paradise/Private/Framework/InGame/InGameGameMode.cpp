@@ -3,6 +3,18 @@
 #include "Framework/InGame/InGameGameMode.h"
 #include "Framework/InGame/InGameGameState.h"
 #include "Framework/Core/ParadiseGameInstance.h"
+#include "Framework/System/ObjectPoolSubsystem.h"
+#include "Framework/System/CombatFXSubsystem.h"
+#include "Data/Assets/FXDataAsset.h"
+#include "Framework/System/AILODSubsystem.h"
+#include "Data/Assets/AILODConfig.h"
+#include "Framework/System/CrowdSubsystem.h"
+#include "Data/Assets/CrowdConfig.h"
+#include "AI/ParadiseFactionTable.h"
+#include "Data/Assets/FactionConfig.h"
+#include "Framework/System/ProjectileSubsystem.h"
+#include "Data/Assets/ProjectileConfig.h"
+#include "Framework/System/BattleRandomSubsystem.h"
 
 AInGameGameMode::AInGameGameMode()
 {
@@ -19,6 +31,42 @@ void AInGameGameMode::BeginPlay()
 	//임시로 1-1 스테이지 정보로 초기화 -> (나중에 GameInstance 연동)
 	InitializeStageData(FName("Stage1_1"));
 
+	//전투 난수 시드 기록 (시드는 월드 시작 시 서브시스템이 정함)
+	if (UBattleRandomSubsystem* BattleRandom = GetWorld()->GetSubsystem<UBattleRandomSubsystem>())
+	{
+		if (CachedGameState) CachedGameState->BattleSeed = BattleRandom->GetSeed();
+	}
+
+	//전투 이펙트 비동기 프리로드 (Ready 카운트다운 동안 로드되어 전투 중 동기 로드 방지)
+	if (UCombatFXSubsystem* FXSubsystem = GetWorld()->GetSubsystem<UCombatFXSubsystem>())
+	{
+		for (UFXDataAsset* FXData : PreloadFXDataAssets)
+		{
+			FXSubsystem->PreloadFXData(FXData);
+		}
+	}
+
+	//AI LOD 단계 설정 (비워두면 서브시스템 기본값)
+	if (UAILODSubsystem* LODSubsystem = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		LODSubsystem->SetConfig(AILODConfig);
+	}
+
+	//군중 회피 역할군 설정
+	if (UCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UCrowdSubsystem>())
+	{
+		Crowd->SetConfig(CrowdConfig);
+	}
+
+	//진영 적대 관계 (유닛 스폰 전에 적용)
+	FParadiseFactionTable::Get().ApplyConfig(FactionConfig);
+
+	//투사체 종류 설정
+	if (UProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UProjectileSubsystem>())
+	{
+		Projectiles->SetConfig(ProjectileConfig);
+	}
+
 	//초기 상태 설정
 	CurrentPhase = EGamePhase::Result;
 
@@ -159,15 +207,41 @@ void AInGameGameMode::OnPhaseReady()
 	UE_LOG(LogTemp, Log, TEXT("Phase: Ready (3초 카운트다운)"));
 
 	//1. 플레이어 준비 상태로 전환
+	//   (스포너들이 BeginPlay에서 요청한 풀 예열은 이 카운트다운 동안 프레임 분할로 진행됩니다)
 
-	//2. 3초 후 전투 단계(Combat)로 전환
+	//2. 3초 후 전투 단계(Combat)로 전환 (예열이 남아 있으면 완료 후 전환)
 	FTimerHandle TimerHandle;
 	GetWorldTimerManager().SetTimer(TimerHandle, [this]()
 		{
-			SetGamePhase(EGamePhase::Combat);
+			TryEnterCombatPhase();
 		}, 3.0f, false);
 }
 
+void AInGameGameMode::TryEnterCombatPhase()
+{
+	if (CurrentPhase != EGamePhase::Ready) return;
+
+	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
+	if (PoolSubsystem && PoolSubsystem->IsPrewarming())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Phase: Ready 연장 - 오브젝트 풀 예열 대기 중 (%.0f%%)"), PoolSubsystem->GetPrewarmProgress() * 100.f);
+		PoolSubsystem->OnPrewarmCompleted.AddUniqueDynamic(this, &AInGameGameMode::HandlePoolPrewarmCompleted);
+		return;
+	}
+
+	SetGamePhase(EGamePhase::Combat);
+}
+
+void AInGameGameMode::HandlePoolPrewarmCompleted()
+{
+	if (UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>())
+	{
+		PoolSubsystem->OnPrewarmCompleted.RemoveDynamic(this, &AInGameGameMode::HandlePoolPrewarmCompleted);
+	}
+
+	TryEnterCombatPhase();
+}
+
 
 void AInGameGameMode::OnPhaseCombat()
 {
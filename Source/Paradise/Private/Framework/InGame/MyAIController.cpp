@@ -3,6 +3,7 @@
 #include "Framework/InGame/MyAIController.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
 #include "AI/MonsterAI.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
@@ -10,6 +11,10 @@
 #include "Objects/HomeBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Framework/Core/ParadiseGameInstance.h"
+#include "Framework/System/UnitSensingSubsystem.h"
+#include "Framework/System/UnitDeathEventSubsystem.h"
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Framework/System/PathCacheSubsystem.h"
 
 AMyAIController::AMyAIController()
 {
@@ -34,10 +39,34 @@ AMyAIController::AMyAIController()
 
 	if (AIPerception)
 	{
+		// 기본은 격자 기반 감지를 사용하므로 AIPerception은 필요한 유닛만 켭니다. (SetUseAIPerception)
+		AIPerception->bAutoActivate = false;
 		AIPerception->OnTargetPerceptionUpdated.AddDynamic(this, &AMyAIController::OnTargetDetected);
 	}
 }
 
+void AMyAIController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	SetUseAIPerception(bUseAIPerception);
+}
+
+void AMyAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UUnitSensingSubsystem* Sensing = GetWorld()->GetSubsystem<UUnitSensingSubsystem>())
+	{
+		Sensing->UnregisterSensor(this);
+	}
+
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->UnwatchTarget(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AMyAIController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
@@ -56,10 +85,22 @@ void AMyAIController::OnPossess(APawn* InPawn)
 				}
 			}
 			RunBehaviorTree(BTAsset);
+			BindTargetObserver();
+			WriteGoalKeys();
 		}
 	}
 }
 
+void AMyAIController::FindPathForMoveRequest(const FAIMoveRequest& MoveRequest, FPathFindingQuery& Query, FNavPathSharedPtr& OutPath) const
+{
+	if (UFlowFieldSubsystem::FindFlowPath(*this, MoveRequest, Query, OutPath)) return;
+
+	// 같은 폴리곤 쌍을 오가는 유닛끼리 경로 통로 공유
+	if (UPathCacheSubsystem::FindMovePath(*this, MoveRequest, OutPath)) return;
+
+	Super::FindPathForMoveRequest(MoveRequest, Query, OutPath);
+}
+
 void AMyAIController::LoadUnitStatsFromTable()
 {
 	ABaseUnit* SelfUnit = Cast<ABaseUnit>(GetPawn());
@@ -72,14 +113,180 @@ void AMyAIController::LoadUnitStatsFromTable()
 
 		if (MyStats)
 		{
-			// 블랙보드 키 "TargetAttackRange"에 데이터 테이블의 AttackRange 값을 저장
-			Blackboard->SetValueAsFloat(TEXT("TargetAttackRange"), MyStats->AttackRange);
-			UE_LOG(LogTemp, Log, TEXT("[%s] Blackboard 'TargetAttackRange' set to: %f"), *SelfUnit->GetName(), MyStats->AttackRange);
+			ApplyUnitStats(*MyStats);
+		}
+	}
+}
+
+void AMyAIController::ApplyUnitStats(const FAIUnitStats& InStats)
+{
+	if (!Blackboard) return;
+
+	// 블랙보드 키 "TargetAttackRange"에 데이터 테이블의 AttackRange 값을 저장
+	Blackboard->SetValueAsFloat(TEXT("TargetAttackRange"), InStats.AttackRange);
+	UE_LOG(LogTemp, Verbose, TEXT("[%s] Blackboard 'TargetAttackRange' set to: %f"), *GetNameSafe(GetPawn()), InStats.AttackRange);
+}
+
+#pragma region 풀 휴면 (Dormant)
+void AMyAIController::EnterDormant()
+{
+	bDormant = true;
+
+	if (BrainComponent)
+	{
+		BrainComponent->PauseLogic(TEXT("Returned to Pool"));
+	}
+	StopMovement();
+	ClearFocus(EAIFocusPriority::Gameplay);
+
+	// BT가 일시정지되면 블랙보드 알림도 보류되므로 타겟 구독은 직접 해제
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->UnwatchTarget(this);
+	}
+
+	// 죽은 대상/이전 스탯이 다음 생애로 넘어가지 않도록 교전 키만 비웁니다.
+	// (SelfActor/HomeBaseActor/AIState/TargetLocation은 빙의가 유지되는 동안 다시 채워지지 않으므로 그대로 둠)
+	if (Blackboard)
+	{
+		Blackboard->ClearValue(BB_KEYS::TargetActor);
+		Blackboard->ClearValue(BB_KEYS::DistanceToTarget);
+		Blackboard->ClearValue(TEXT("TargetAttackRange"));
+	}
+
+	// 숨겨진 상태로 감지 이벤트를 받지 않도록 인지도 잠시 끕니다.
+	if (AIPerception)
+	{
+		AIPerception->ForgetAll();
+		AIPerception->Deactivate();
+	}
+}
+
+void AMyAIController::StartUnitBehavior(UBehaviorTree* InBT, const FAIUnitStats* InStats)
+{
+	if (!InBT) return;
+
+	if (bUseAIPerception && AIPerception && !AIPerception->IsActive())
+	{
+		AIPerception->Activate();
+	}
+
+	UBehaviorTreeComponent* BTComp = Cast<UBehaviorTreeComponent>(BrainComponent);
+	const bool bReuseTree = bDormant && BTComp && BTComp->GetRootTree() == InBT && Blackboard;
+	bDormant = false;
+
+	if (!bReuseTree)
+	{
+		// 첫 스폰이거나 유닛 종류가 바뀌어 BT가 다른 경우에만 새로 실행
+		RunBehaviorTree(InBT);
+		BindTargetObserver();
+	}
+
+	ResetTargetKeys();
+	WriteGoalKeys();
+	if (InStats)
+	{
+		ApplyUnitStats(*InStats);
+	}
+	else
+	{
+		LoadUnitStatsFromTable();
+	}
+
+	if (bReuseTree)
+	{
+		// 노드 인스턴스/메모리는 그대로 두고 실행 위치만 루트로 되돌립니다.
+		BTComp->ResumeLogic(TEXT("Activated from Pool"));
+		BTComp->RestartTree();
+	}
+}
+
+void AMyAIController::ResetTargetKeys()
+{
+	if (!Blackboard) return;
+
+	Blackboard->ClearValue(BB_KEYS::TargetActor);
+	Blackboard->SetValueAsFloat(BB_KEYS::DistanceToTarget, 999999.0f);
+}
+
+void AMyAIController::WriteGoalKeys()
+{
+	const UFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+	if (!Blackboard || !FlowField) return;
+
+	FlowField->WriteGoalKeys(*Blackboard);
+}
+
+void AMyAIController::BindTargetObserver()
+{
+	if (!Blackboard) return;
+
+	const FBlackboard::FKey KeyID = Blackboard->GetKeyID(BB_KEYS::TargetActor);
+	if (KeyID == FBlackboard::InvalidKey) return;
+
+	// 다른 BB 에셋으로 바뀌었을 수 있으므로 매번 다시 등록
+	Blackboard->UnregisterObserversFrom(this);
+	Blackboard->RegisterObserver(KeyID, this, FOnBlackboardChangeNotification::CreateUObject(this, &AMyAIController::OnTargetKeyChanged));
+}
+
+EBlackboardNotificationResult AMyAIController::OnTargetKeyChanged(const UBlackboardComponent& BlackboardComp, FBlackboard::FKey ChangedKeyID)
+{
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		// 타겟이 비워지면(nullptr) 구독 해제만 됨
+		DeathEvents->WatchTarget(this, Cast<AActor>(BlackboardComp.GetValueAsObject(BB_KEYS::TargetActor)));
+	}
+	return EBlackboardNotificationResult::ContinueObserving;
+}
+#pragma endregion 풀 휴면 (Dormant)
+
+#pragma region 감지 (Sensing)
+void AMyAIController::SetUseAIPerception(bool bEnable)
+{
+	bUseAIPerception = bEnable;
+
+	UUnitSensingSubsystem* Sensing = GetWorld()->GetSubsystem<UUnitSensingSubsystem>();
+	if (bUseAIPerception)
+	{
+		if (Sensing)
+		{
+			Sensing->UnregisterSensor(this);
+		}
+		if (AIPerception && !AIPerception->IsActive() && !bDormant)
+		{
+			AIPerception->Activate();
 		}
 	}
+	else
+	{
+		if (AIPerception && AIPerception->IsActive())
+		{
+			AIPerception->ForgetAll();
+			AIPerception->Deactivate();
+		}
+		if (Sensing)
+		{
+			Sensing->RegisterSensor(this);
+		}
+	}
+}
+
+float AMyAIController::GetSightRadius() const
+{
+	return SightConfig ? SightConfig->SightRadius : 800.f;
+}
+
+float AMyAIController::GetLoseSightRadius() const
+{
+	return SightConfig ? SightConfig->LoseSightRadius : 1000.f;
 }
 
 void AMyAIController::OnTargetDetected(AActor* Actor, FAIStimulus Stimulus)
+{
+	ProcessSensedActor(Actor, Stimulus.WasSuccessfullySensed());
+}
+
+void AMyAIController::ProcessSensedActor(AActor* Actor, bool bSensed)
 {
 	if (Blackboard == nullptr || Actor == nullptr) return;
 
@@ -96,14 +303,14 @@ void AMyAIController::OnTargetDetected(AActor* Actor, FAIStimulus Stimulus)
 	AActor* CurrentTarget = Cast<AActor>(Blackboard->GetValueAsObject(BB_KEYS::TargetActor));
 	if (CurrentTarget && CurrentTarget->IsValidLowLevel())
 	{
-		if (CurrentTarget == Actor && !Stimulus.WasSuccessfullySensed())
+		if (CurrentTarget == Actor && !bSensed)
 		{
 			Blackboard->ClearValue(BB_KEYS::TargetActor);
 		}
 		return;
 	}
 
-	if (Stimulus.WasSuccessfullySensed())
+	if (bSensed)
 	{
 		ABaseUnit* TargetUnit = Cast<ABaseUnit>(Actor);
 		ABaseUnit* SelfUnit = Cast<ABaseUnit>(GetPawn());
@@ -113,4 +320,5 @@ void AMyAIController::OnTargetDetected(AActor* Actor, FAIStimulus Stimulus)
 			Blackboard->SetValueAsObject(BB_KEYS::TargetActor, Actor);
 		}
 	}
-}
\ No newline at end of file
+}
+#pragma endregion 감지 (Sensing)
@@ -3,6 +3,8 @@
 #include "Framework/InGame/MyAIController_Range.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Framework/System/PathCacheSubsystem.h"
 
 void AMyAIController_Range::OnPossess(APawn* InPawn)
 {
@@ -11,5 +13,22 @@ void AMyAIController_Range::OnPossess(APawn* InPawn)
 	if (BTAsset)
 	{
 		RunBehaviorTree(BTAsset);
+
+		// 공유 목표(HomeBase) 기록
+		const UFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+		if (Blackboard && FlowField)
+		{
+			FlowField->WriteGoalKeys(*Blackboard);
+		}
 	}
+}
+
+void AMyAIController_Range::FindPathForMoveRequest(const FAIMoveRequest& MoveRequest, FPathFindingQuery& Query, FNavPathSharedPtr& OutPath) const
+{
+	if (UFlowFieldSubsystem::FindFlowPath(*this, MoveRequest, Query, OutPath)) return;
+
+	// 같은 폴리곤 쌍을 오가는 유닛끼리 경로 통로 공유
+	if (UPathCacheSubsystem::FindMovePath(*this, MoveRequest, OutPath)) return;
+
+	Super::FindPathForMoveRequest(MoveRequest, Query, OutPath);
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/AILODSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Data/Assets/AILODConfig.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseAILOD"), STATGROUP_ParadiseAILOD, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Evaluate Tiers"), STAT_AILOD_Evaluate, STATGROUP_ParadiseAILOD);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier 0 Units"), STAT_AILOD_Tier0, STATGROUP_ParadiseAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier 1 Units"), STAT_AILOD_Tier1, STATGROUP_ParadiseAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier 2+ Units"), STAT_AILOD_Tier2Plus, STATGROUP_ParadiseAILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier Changes / Frame"), STAT_AILOD_Changes, STATGROUP_ParadiseAILOD);
+
+static TAutoConsoleVariable<int32> CVarAILODEnable(
+	TEXT("paradise.ai.lod.Enable"),
+	1,
+	TEXT("1이면 거리/가시성에 따라 유닛 AI 갱신 주기를 낮춥니다. 0으로 끄면 모든 유닛을 단계 0으로 되돌립니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAILODUnitsPerFrame(
+	TEXT("paradise.ai.lod.UnitsPerFrame"),
+	64,
+	TEXT("프레임당 단계를 다시 계산할 유닛 수."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAILODForceTier(
+	TEXT("paradise.ai.lod.ForceTier"),
+	-1,
+	TEXT("0 이상이면 모든 유닛을 해당 단계로 고정합니다. (디버그용, -1 = 사용 안 함)"),
+	ECVF_Cheat);
+
+void UAILODSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SetConfig(nullptr);
+}
+
+TStatId UAILODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAILODSubsystem, STATGROUP_Tickables);
+}
+
+void UAILODSubsystem::SetConfig(const UAILODConfig* InConfig)
+{
+	if (InConfig && InConfig->Tiers.Num() > 0)
+	{
+		Tiers = InConfig->Tiers;
+		HysteresisScale = FMath::Max(InConfig->HysteresisScale, 1.f);
+	}
+	else
+	{
+		BuildDefaultTiers();
+	}
+
+	FrontLineSearchRadius = 0.f;
+	for (const FAILODTierSettings& Tier : Tiers)
+	{
+		FrontLineSearchRadius = FMath::Max(FrontLineSearchRadius, Tier.MaxFrontLineDistance * HysteresisScale);
+	}
+}
+
+void UAILODSubsystem::BuildDefaultTiers()
+{
+	Tiers.Reset();
+	HysteresisScale = 1.2f;
+
+	// 0: 화면 안 근거리 또는 교전 중
+	FAILODTierSettings& Near = Tiers.AddDefaulted_GetRef();
+	Near.MaxViewDistance = 2500.f;
+	Near.MaxFrontLineDistance = 1500.f;
+
+	// 1: 화면 안 중거리 또는 전선 근처
+	FAILODTierSettings& Mid = Tiers.AddDefaulted_GetRef();
+	Mid.MaxViewDistance = 5000.f;
+	Mid.MaxFrontLineDistance = 3000.f;
+	Mid.ServiceIntervalScale = 2.5f;
+	Mid.ControllerTickInterval = 0.05f;
+	Mid.MovementTickInterval = 0.033f;
+	Mid.MeshTickInterval = 0.033f;
+	Mid.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+
+	// 2: 나머지 (화면 밖 후방 낙오병)
+	FAILODTierSettings& Far = Tiers.AddDefaulted_GetRef();
+	Far.ServiceIntervalScale = 6.f;
+	Far.ControllerTickInterval = 0.2f;
+	Far.MovementTickInterval = 0.1f;
+	Far.MeshTickInterval = 0.25f;
+	Far.AnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+}
+
+void UAILODSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AILOD_Evaluate);
+
+	Super::Tick(DeltaTime);
+
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	if (!Grid || Tiers.Num() == 0) return;
+
+	const TArray<FUnitGridEntry>& Entries = Grid->GetEntries();
+
+	// 꺼지면 한 번만 전원 단계 0으로 원복
+	if (!CVarAILODEnable.GetValueOnGameThread())
+	{
+		if (bTiersApplied)
+		{
+			for (const FUnitGridEntry& Entry : Entries)
+			{
+				ResetUnit(Entry.Unit.Get());
+			}
+			bTiersApplied = false;
+		}
+		return;
+	}
+
+	const int32 NumEntries = Entries.Num();
+	if (NumEntries == 0) return;
+
+	const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+	const FVector ViewLocation = CameraManager ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+	const int32 ForcedTier = CVarAILODForceTier.GetValueOnGameThread();
+
+	const int32 Budget = FMath::Min(CVarAILODUnitsPerFrame.GetValueOnGameThread(), NumEntries);
+	for (int32 Count = 0; Count < Budget; ++Count)
+	{
+		if (EvaluateCursor >= NumEntries)
+		{
+			EvaluateCursor = 0;
+		}
+
+		ABaseUnit* Unit = Entries[EvaluateCursor++].Unit.Get();
+		if (!Unit || Unit->bIsDead) continue;
+
+		const int32 NewTier = ForcedTier >= 0
+			? FMath::Min(ForcedTier, Tiers.Num() - 1)
+			: EvaluateTier(Unit, Grid, ViewLocation, CameraManager != nullptr);
+
+		if (NewTier != Unit->AILODTier)
+		{
+			ApplyTier(Unit, NewTier);
+			INC_DWORD_STAT(STAT_AILOD_Changes);
+		}
+	}
+	bTiersApplied = true;
+
+#if STATS
+	uint32 TierCounts[3] = { 0, 0, 0 };
+	for (const FUnitGridEntry& Entry : Entries)
+	{
+		if (const ABaseUnit* Unit = Entry.Unit.Get())
+		{
+			++TierCounts[FMath::Min<int32>(Unit->AILODTier, 2)];
+		}
+	}
+	SET_DWORD_STAT(STAT_AILOD_Tier0, TierCounts[0]);
+	SET_DWORD_STAT(STAT_AILOD_Tier1, TierCounts[1]);
+	SET_DWORD_STAT(STAT_AILOD_Tier2Plus, TierCounts[2]);
+#endif
+}
+
+int32 UAILODSubsystem::EvaluateTier(const ABaseUnit* Unit, const UUnitSpatialGridSubsystem* Grid, const FVector& ViewLocation, bool bHasView) const
+{
+	const int32 LastTier = Tiers.Num() - 1;
+	const int32 CurrentTier = FMath::Min<int32>(Unit->AILODTier, LastTier);
+
+	const float ViewDistSq = bHasView ? FVector::DistSquared(ViewLocation, Unit->GetActorLocation()) : MAX_flt;
+	const bool bRendered = Unit->WasRecentlyRendered(0.25f);
+
+	float FrontLineDist = MAX_flt;
+	if (FrontLineSearchRadius > 0.f && !Grid->FindNearestEnemy(Unit, FrontLineSearchRadius, &FrontLineDist))
+	{
+		FrontLineDist = MAX_flt;
+	}
+
+	// 마지막 단계는 조건 없이 나머지 전부
+	int32 RawTier = LastTier;
+	for (int32 TierIndex = 0; TierIndex < LastTier; ++TierIndex)
+	{
+		if (QualifiesForTier(TierIndex, ViewDistSq, bRendered, FrontLineDist, 1.f))
+		{
+			RawTier = TierIndex;
+			break;
+		}
+	}
+
+	// 정밀도를 올릴 때는 즉시, 내릴 때는 넓힌 조건에서도 벗어났을 때만
+	if (RawTier > CurrentTier && CurrentTier < LastTier
+		&& QualifiesForTier(CurrentTier, ViewDistSq, bRendered, FrontLineDist, HysteresisScale))
+	{
+		return CurrentTier;
+	}
+	return RawTier;
+}
+
+bool UAILODSubsystem::QualifiesForTier(int32 TierIndex, float ViewDistSq, bool bRendered, float FrontLineDist, float Scale) const
+{
+	const FAILODTierSettings& Tier = Tiers[TierIndex];
+
+	if (Tier.MaxViewDistance > 0.f && (bRendered || !Tier.bViewRequiresRendered)
+		&& ViewDistSq <= FMath::Square(Tier.MaxViewDistance * Scale))
+	{
+		return true;
+	}
+
+	return Tier.MaxFrontLineDistance > 0.f && FrontLineDist <= Tier.MaxFrontLineDistance * Scale;
+}
+
+void UAILODSubsystem::ApplyTier(ABaseUnit* Unit, int32 TierIndex) const
+{
+	if (!Tiers.IsValidIndex(TierIndex)) return;
+
+	const FAILODTierSettings& Tier = Tiers[TierIndex];
+	Unit->AILODTier = static_cast<uint8>(TierIndex);
+
+	if (AAIController* AIC = Cast<AAIController>(Unit->GetController()))
+	{
+		AIC->SetActorTickInterval(Tier.ControllerTickInterval);
+		if (UPathFollowingComponent* PathFollowing = AIC->GetPathFollowingComponent())
+		{
+			PathFollowing->SetComponentTickInterval(Tier.ControllerTickInterval);
+		}
+	}
+
+	if (UCharacterMovementComponent* MoveComp = Unit->GetCharacterMovement())
+	{
+		MoveComp->SetComponentTickInterval(Tier.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* MeshComp = Unit->GetMesh())
+	{
+		MeshComp->SetComponentTickInterval(Tier.MeshTickInterval);
+		// 단계 0(가장 정밀)은 유닛 원래 설정으로 복원
+		MeshComp->VisibilityBasedAnimTickOption = TierIndex == 0 ? Unit->DefaultAnimTickOption : Tier.AnimTickOption;
+	}
+}
+
+void UAILODSubsystem::ResetUnit(ABaseUnit* Unit)
+{
+	if (!Unit || Unit->AILODTier == 0) return;
+
+	ApplyTier(Unit, 0);
+}
+
+float UAILODSubsystem::GetServiceIntervalScale(const UBehaviorTreeComponent& OwnerComp)
+{
+	const AAIController* AIC = OwnerComp.GetAIOwner();
+	const ABaseUnit* Unit = AIC ? Cast<ABaseUnit>(AIC->GetPawn()) : nullptr;
+	if (!Unit || Unit->AILODTier == 0) return 1.f;
+
+	const UAILODSubsystem* LODSubsystem = OwnerComp.GetWorld()->GetSubsystem<UAILODSubsystem>();
+	if (!LODSubsystem || !LODSubsystem->Tiers.IsValidIndex(Unit->AILODTier)) return 1.f;
+
+	return FMath::Max(LODSubsystem->Tiers[Unit->AILODTier].ServiceIntervalScale, 1.f);
+}
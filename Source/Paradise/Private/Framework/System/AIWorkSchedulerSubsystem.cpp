@@ -0,0 +1,187 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/AIWorkSchedulerSubsystem.h"
+#include "Interfaces/ParadiseScheduledAIWork.h"
+#include "AI/MonsterAI.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseAIScheduler"), STATGROUP_ParadiseAIScheduler, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Execute Work"), STAT_AIScheduler_Execute, STATGROUP_ParadiseAIScheduler);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Executed / Frame"), STAT_AIScheduler_Executed, STATGROUP_ParadiseAIScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred (Pending)"), STAT_AIScheduler_Deferred, STATGROUP_ParadiseAIScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Starved (Over Budget) / Frame"), STAT_AIScheduler_Starved, STATGROUP_ParadiseAIScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Duplicates Dropped / Frame"), STAT_AIScheduler_Duplicates, STATGROUP_ParadiseAIScheduler);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Avg Staleness (ms)"), STAT_AIScheduler_AvgStaleness, STATGROUP_ParadiseAIScheduler);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Max Staleness (ms)"), STAT_AIScheduler_MaxStaleness, STATGROUP_ParadiseAIScheduler);
+
+static TAutoConsoleVariable<int32> CVarAISchedulerEnable(
+	TEXT("paradise.ai.scheduler.Enable"),
+	1,
+	TEXT("1이면 BT 서비스/태스크 작업을 스케줄러가 프레임 예산 안에서 실행합니다. 0이면 노드가 즉시 실행합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAISchedulerBudgetMs(
+	TEXT("paradise.ai.scheduler.BudgetMs"),
+	1.0f,
+	TEXT("프레임당 AI 작업에 쓸 수 있는 시간(ms)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAISchedulerStarvationSeconds(
+	TEXT("paradise.ai.scheduler.StarvationSeconds"),
+	0.5f,
+	TEXT("이 시간(초) 이상 기다린 작업은 예산을 넘기더라도 다음 프레임에 실행합니다."),
+	ECVF_Default);
+
+void UAIWorkSchedulerSubsystem::Deinitialize()
+{
+	Queue.Reset();
+	PendingKeys.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIWorkSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIWorkSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UAIWorkSchedulerSubsystem::IsEnabled()
+{
+	return CVarAISchedulerEnable.GetValueOnGameThread() != 0;
+}
+
+bool UAIWorkSchedulerSubsystem::Enqueue(UBehaviorTreeComponent& OwnerComp, UObject* Work)
+{
+	IParadiseScheduledAIWork* WorkInterface = Cast<IParadiseScheduledAIWork>(Work);
+	if (!WorkInterface) return false;
+
+	const FWorkKey Key(&OwnerComp, Work);
+	if (PendingKeys.Contains(Key))
+	{
+		INC_DWORD_STAT(STAT_AIScheduler_Duplicates);
+		return false;
+	}
+	PendingKeys.Add(Key);
+
+	FScheduledAIWorkItem& Item = Queue.AddDefaulted_GetRef();
+	Item.OwnerComp = &OwnerComp;
+	Item.WorkObject = Work;
+	Item.Work = WorkInterface;
+	Item.OwnerKey = Key.Key;
+	Item.WorkKey = Key.Value;
+	Item.EnqueueTime = FPlatformTime::Seconds();
+	Item.bCombat = IsInCombat(OwnerComp);
+	return true;
+}
+
+void UAIWorkSchedulerSubsystem::Cancel(const UBehaviorTreeComponent& OwnerComp, const UObject* Work)
+{
+	const FWorkKey Key(&OwnerComp, Work);
+	if (PendingKeys.Remove(Key) == 0) return;
+
+	// 실행 도중 호출될 수 있으므로 배열은 건드리지 않고 표시만 (Tick 끝에서 정리)
+	for (FScheduledAIWorkItem& Item : Queue)
+	{
+		if (Item.Work && Item.OwnerKey == Key.Key && Item.WorkKey == Key.Value)
+		{
+			Item.Work = nullptr;
+			break;
+		}
+	}
+}
+
+bool UAIWorkSchedulerSubsystem::IsInCombat(const UBehaviorTreeComponent& OwnerComp)
+{
+	const UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
+	return BB && BB->GetValueAsObject(BB_KEYS::TargetActor) != nullptr;
+}
+
+void UAIWorkSchedulerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AIScheduler_Execute);
+
+	Super::Tick(DeltaTime);
+
+	ExecutedThisFrame = 0;
+	StalenessSumThisFrame = 0.0;
+	MaxStalenessThisFrame = 0.0;
+
+	// 실행 중 새로 예약된 작업은 다음 프레임부터 처리
+	const int32 NumAtStart = Queue.Num();
+	if (NumAtStart > 0)
+	{
+		const double Now = FPlatformTime::Seconds();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const double BudgetMs = CVarAISchedulerBudgetMs.GetValueOnGameThread();
+		const double StarvationSeconds = CVarAISchedulerStarvationSeconds.GetValueOnGameThread();
+
+		auto IsOverBudget = [&]()
+		{
+			return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) >= BudgetMs;
+		};
+
+		// 1. 기아 작업: 예산과 무관하게 실행
+		for (int32 Index = 0; Index < NumAtStart; ++Index)
+		{
+			if (Queue[Index].Work && Now - Queue[Index].EnqueueTime >= StarvationSeconds)
+			{
+				if (IsOverBudget())
+				{
+					INC_DWORD_STAT(STAT_AIScheduler_Starved);
+				}
+				ExecuteAt(Index, Now);
+			}
+		}
+
+		// 2. 교전 중 → 3. 일반 (예약 순서대로, 예산 소진 시 중단)
+		for (const bool bCombatPass : { true, false })
+		{
+			for (int32 Index = 0; Index < NumAtStart && !IsOverBudget(); ++Index)
+			{
+				if (Queue[Index].Work && Queue[Index].bCombat == bCombatPass)
+				{
+					ExecuteAt(Index, Now);
+				}
+			}
+		}
+
+		// 실행/취소된 항목 정리 (RemoveAll은 순서를 유지하므로 라운드 로빈이 깨지지 않음)
+		Queue.RemoveAll([](const FScheduledAIWorkItem& Item) { return Item.Work == nullptr; });
+	}
+
+	SET_DWORD_STAT(STAT_AIScheduler_Executed, ExecutedThisFrame);
+	SET_DWORD_STAT(STAT_AIScheduler_Deferred, Queue.Num());
+	SET_FLOAT_STAT(STAT_AIScheduler_AvgStaleness, ExecutedThisFrame > 0 ? StalenessSumThisFrame / ExecutedThisFrame : 0.0);
+	SET_FLOAT_STAT(STAT_AIScheduler_MaxStaleness, MaxStalenessThisFrame);
+}
+
+bool UAIWorkSchedulerSubsystem::ExecuteAt(int32 QueueIndex, double Now)
+{
+	// 실행 중 Enqueue로 배열이 재할당될 수 있으므로 복사본으로 실행
+	const FScheduledAIWorkItem Item = Queue[QueueIndex];
+
+	UBehaviorTreeComponent* OwnerComp = Item.OwnerComp.Get();
+	if (OwnerComp && Item.WorkObject.IsValid() && OwnerComp->IsPaused())
+	{
+		// 휴면/플레이어 조작 중에는 재개될 때까지 대기
+		return false;
+	}
+
+	Queue[QueueIndex].Work = nullptr;
+	PendingKeys.Remove(FWorkKey(Item.OwnerKey, Item.WorkKey));
+
+	if (!OwnerComp || !Item.WorkObject.IsValid() || !OwnerComp->IsRunning()) return true;
+
+	const double StalenessMs = (Now - Item.EnqueueTime) * 1000.0;
+	++ExecutedThisFrame;
+	StalenessSumThisFrame += StalenessMs;
+	MaxStalenessThisFrame = FMath::Max(MaxStalenessThisFrame, StalenessMs);
+
+	Item.Work->ExecuteScheduledWork(*OwnerComp);
+	return true;
+}
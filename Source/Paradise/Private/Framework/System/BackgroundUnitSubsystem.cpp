@@ -0,0 +1,532 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/BackgroundUnitSubsystem.h"
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/ParadiseFactionTable.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/DataTable.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseBackground"), STATGROUP_ParadiseBackground, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Simulate Movement"), STAT_Background_Simulate, STATGROUP_ParadiseBackground);
+DECLARE_CYCLE_STAT(TEXT("Promote / Demote"), STAT_Background_Promotion, STATGROUP_ParadiseBackground);
+DECLARE_CYCLE_STAT(TEXT("Update Instances"), STAT_Background_Instances, STATGROUP_ParadiseBackground);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Background Units"), STAT_Background_Units, STATGROUP_ParadiseBackground);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Promoted Units"), STAT_Background_Promoted, STATGROUP_ParadiseBackground);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Promotions / Frame"), STAT_Background_Promotions, STATGROUP_ParadiseBackground);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Demotions / Frame"), STAT_Background_Demotions, STATGROUP_ParadiseBackground);
+
+static TAutoConsoleVariable<int32> CVarBackgroundEnable(
+	TEXT("paradise.ai.background.Enable"),
+	1,
+	TEXT("1이면 교전 거리 밖의 적을 액터 없이 시뮬레이션합니다. 0으로 끄면 남은 배경 유닛을 모두 액터로 승격합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBackgroundPromoteRadius(
+	TEXT("paradise.ai.background.PromoteRadius"),
+	3500.f,
+	TEXT("적대 진영 유닛(스쿼드, HomeBase)이 이 거리(cm) 안에 있으면 액터로 승격합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBackgroundCameraRadius(
+	TEXT("paradise.ai.background.CameraRadius"),
+	2500.f,
+	TEXT("카메라가 이 거리(cm) 안에 있으면 액터로 승격합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarBackgroundDemoteScale(
+	TEXT("paradise.ai.background.DemoteScale"),
+	1.3f,
+	TEXT("승격 거리의 이 배수보다 멀어져야 다시 배경 유닛으로 강등합니다. (경계에서 반복 승격/강등 방지)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBackgroundMaxTransitions(
+	TEXT("paradise.ai.background.MaxTransitionsPerFrame"),
+	8,
+	TEXT("프레임당 승격(또는 강등)할 최대 유닛 수."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBackgroundMaxPromoted(
+	TEXT("paradise.ai.background.MaxPromoted"),
+	150,
+	TEXT("동시에 액터로 존재할 수 있는 승격 유닛 수. 넘으면 교전 거리 안이어도 배경 유닛으로 둡니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarBackgroundChecksPerFrame(
+	TEXT("paradise.ai.background.ChecksPerFrame"),
+	2000,
+	TEXT("프레임당 승격 여부를 검사할 배경 유닛 수."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GBackgroundDumpCommand(
+	TEXT("paradise.ai.background.Dump"),
+	TEXT("배경 유닛/승격 유닛 수를 종류별로 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UBackgroundUnitSubsystem* Background = World ? World->GetSubsystem<UBackgroundUnitSubsystem>() : nullptr)
+		{
+			Background->DumpState();
+		}
+	}));
+
+namespace BackgroundUnit
+{
+	/** @brief 도착으로 보고 멈추는 거리 (cm) */
+	static constexpr float ArrivalDistance = 100.f;
+
+	FORCEINLINE int64 MakeCellKey(int32 CellX, int32 CellY)
+	{
+		return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+	}
+}
+
+#pragma region FBackgroundUnitArray
+int32 FBackgroundUnitArray::Add(const FVector& InLocation, float InYaw, float InHP, uint8 InFactionId, uint16 InArchetype, const FVector& InTarget)
+{
+	Yaw.Add(InYaw);
+	HP.Add(InHP);
+	FactionId.Add(InFactionId);
+	Archetype.Add(InArchetype);
+	TargetLocation.Add(InTarget);
+	return Location.Add(InLocation);
+}
+
+void FBackgroundUnitArray::RemoveAtSwap(int32 Index)
+{
+	Location.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Yaw.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HP.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FactionId.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Archetype.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TargetLocation.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FBackgroundUnitArray::Reset()
+{
+	Location.Reset();
+	Yaw.Reset();
+	HP.Reset();
+	FactionId.Reset();
+	Archetype.Reset();
+	TargetLocation.Reset();
+}
+#pragma endregion FBackgroundUnitArray
+
+void UBackgroundUnitSubsystem::Deinitialize()
+{
+	Units.Reset();
+	Promoted.Reset();
+	FocusCells.Reset();
+	Archetypes.Reset();
+	InstanceOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UBackgroundUnitSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBackgroundUnitSubsystem, STATGROUP_Tickables);
+}
+
+bool UBackgroundUnitSubsystem::IsEnabled()
+{
+	return CVarBackgroundEnable.GetValueOnGameThread() != 0;
+}
+
+void UBackgroundUnitSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Archetypes.Num() == 0) return;
+
+	if (IsEnabled())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Background_Simulate);
+		SimulateMovement(DeltaTime);
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Background_Promotion);
+		GatherFocusPoints();
+		UpdateDemotions();
+		UpdatePromotions();
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Background_Instances);
+		UpdateInstances();
+	}
+
+	SET_DWORD_STAT(STAT_Background_Units, Units.Num());
+	SET_DWORD_STAT(STAT_Background_Promoted, Promoted.Num());
+}
+
+bool UBackgroundUnitSubsystem::AddUnit(TSubclassOf<ABaseUnit> UnitClass, UDataTable* StatsTable, UDataTable* AssetsTable, FName RowName, const FVector& Location, float Yaw)
+{
+	const int32 ArchetypeIndex = FindOrAddArchetype(UnitClass, StatsTable, AssetsTable, RowName);
+	if (ArchetypeIndex == INDEX_NONE) return false;
+
+	const FBackgroundUnitArchetype& Archetype = Archetypes[ArchetypeIndex];
+
+	// 목표가 없으면 제자리 대기 (스쿼드가 다가오면 승격되어 BT가 이어받음)
+	const UFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+	const FVector Target = FlowField && FlowField->HasGoal() ? FlowField->GetGoalLocation() : Location;
+
+	Units.Add(Location, Yaw, Archetype.Stats->BaseMaxHP, Archetype.FactionId, static_cast<uint16>(ArchetypeIndex), Target);
+	return true;
+}
+
+void UBackgroundUnitSubsystem::ClearUnits()
+{
+	Units.Reset();
+	PromoteCursor = 0;
+	UpdateInstances();
+}
+
+int32 UBackgroundUnitSubsystem::FindOrAddArchetype(TSubclassOf<ABaseUnit> UnitClass, UDataTable* StatsTable, UDataTable* AssetsTable, FName RowName)
+{
+	// 종류 수는 스테이지당 몇 개 수준이므로 선형 검색
+	const int32 Existing = Archetypes.IndexOfByPredicate([&](const FBackgroundUnitArchetype& Archetype)
+	{
+		return Archetype.UnitClass == UnitClass && Archetype.StatsTable == StatsTable
+			&& Archetype.AssetsTable == AssetsTable && Archetype.RowName == RowName;
+	});
+	if (Existing != INDEX_NONE) return Existing;
+
+	if (!UnitClass || !StatsTable || !AssetsTable || RowName.IsNone()) return INDEX_NONE;
+	if (Archetypes.Num() >= MAX_uint16) return INDEX_NONE;
+
+	FEnemyStats* Stats = StatsTable->FindRow<FEnemyStats>(RowName, TEXT("BackgroundUnit"));
+	FEnemyAssets* Assets = AssetsTable->FindRow<FEnemyAssets>(RowName, TEXT("BackgroundUnit"));
+	if (!Stats || !Assets || Assets->ProxyMesh.IsNull()) return INDEX_NONE;
+
+	UStaticMesh* ProxyMesh = Assets->ProxyMesh.LoadSynchronous();
+	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
+	AActor* Owner = GetOrCreateInstanceOwner();
+	if (!ProxyMesh || !PoolSubsystem || !Owner)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ [Background] %s 행을 배경 유닛으로 등록하지 못했습니다. 액터로 스폰합니다."), *RowName.ToString());
+		return INDEX_NONE;
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(Owner);
+	Instances->SetStaticMesh(ProxyMesh);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCanEverAffectNavigation(false);
+	Instances->SetupAttachment(Owner->GetRootComponent());
+	Instances->RegisterComponent();
+	Owner->AddInstanceComponent(Instances);
+
+	FBackgroundUnitArchetype& Archetype = Archetypes.AddDefaulted_GetRef();
+	Archetype.UnitClass = UnitClass;
+	Archetype.StatsTable = StatsTable;
+	Archetype.AssetsTable = AssetsTable;
+	Archetype.RowName = RowName;
+	Archetype.Stats = Stats;
+	Archetype.Assets = Assets;
+	Archetype.Instances = Instances;
+	Archetype.PoolHandle = PoolSubsystem->ResolvePoolHandle(UnitClass);
+	Archetype.FactionId = FParadiseFactionTable::Get().FindOrAddFaction(Stats->FactionTag);
+	Archetype.MoveSpeed = Stats->BaseMoveSpeed;
+	Archetype.Scale = Assets->Scale;
+
+	UE_LOG(LogTemp, Log, TEXT("✅ [Background] 배경 유닛 종류 등록: %s (%s)"), *RowName.ToString(), *ProxyMesh->GetName());
+	return Archetypes.Num() - 1;
+}
+
+AActor* UBackgroundUnitSubsystem::GetOrCreateInstanceOwner()
+{
+	if (IsValid(InstanceOwner)) return InstanceOwner;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	InstanceOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!InstanceOwner) return nullptr;
+
+	// 인스턴스 트랜스폼은 월드 좌표로 넣으므로 루트는 원점에 고정
+	USceneComponent* Root = NewObject<USceneComponent>(InstanceOwner, TEXT("BackgroundUnitRoot"));
+	Root->SetMobility(EComponentMobility::Static);
+	InstanceOwner->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	return InstanceOwner;
+}
+
+#pragma region 시뮬레이션
+void UBackgroundUnitSubsystem::SimulateMovement(float DeltaTime)
+{
+	const int32 NumUnits = Units.Num();
+	if (NumUnits == 0) return;
+
+	const UFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+	const bool bUseFlowField = FlowField && FlowField->IsReady();
+
+	// 유닛마다 자기 슬롯만 쓰고 흐름장은 읽기만 하므로 잠금 불필요
+	ParallelFor(NumUnits, [&](int32 Index)
+	{
+		FVector& Location = Units.Location[Index];
+		const FVector ToTarget = Units.TargetLocation[Index] - Location;
+		if (ToTarget.SizeSquared2D() <= FMath::Square(BackgroundUnit::ArrivalDistance)) return;
+
+		FVector Direction;
+		if (!bUseFlowField || !FlowField->SampleDirection(Location, Direction))
+		{
+			Direction = ToTarget.GetSafeNormal2D();
+		}
+
+		Location += Direction * (Archetypes[Units.Archetype[Index]].MoveSpeed * DeltaTime);
+		Units.Yaw[Index] = FMath::RadiansToDegrees(FMath::Atan2(Direction.Y, Direction.X));
+
+		// 액터가 없으므로 흐름장에 투영해둔 네비메시 높이로 지면을 따라감
+		float Height;
+		if (bUseFlowField && FlowField->SampleHeight(Location, Height))
+		{
+			Location.Z = Height;
+		}
+	});
+}
+
+void UBackgroundUnitSubsystem::UpdateInstances()
+{
+	for (FBackgroundUnitArchetype& Archetype : Archetypes)
+	{
+		Archetype.InstanceTransforms.Reset();
+	}
+
+	for (int32 Index = 0; Index < Units.Num(); ++Index)
+	{
+		FBackgroundUnitArchetype& Archetype = Archetypes[Units.Archetype[Index]];
+		Archetype.InstanceTransforms.Emplace(FRotator(0.f, Units.Yaw[Index], 0.f), Units.Location[Index], FVector(Archetype.Scale));
+	}
+
+	for (FBackgroundUnitArchetype& Archetype : Archetypes)
+	{
+		UInstancedStaticMeshComponent* Instances = Archetype.Instances;
+		if (!IsValid(Instances)) continue;
+
+		const int32 Current = Instances->GetInstanceCount();
+		const int32 Wanted = Archetype.InstanceTransforms.Num();
+		if (Current == 0 && Wanted == 0) continue;
+
+		// 인스턴스 순서는 의미가 없으므로 개수만 맞추고 전체 트랜스폼을 한 번에 덮어씀
+		if (Wanted > Current)
+		{
+			const TArray<FTransform> Added(Archetype.InstanceTransforms.GetData() + Current, Wanted - Current);
+			Instances->AddInstances(Added, false, true, false);
+		}
+		else if (Wanted < Current)
+		{
+			TArray<int32> Removed;
+			Removed.Reserve(Current - Wanted);
+			for (int32 InstanceIndex = Wanted; InstanceIndex < Current; ++InstanceIndex)
+			{
+				Removed.Add(InstanceIndex);
+			}
+			Instances->RemoveInstances(Removed);
+		}
+
+		if (Wanted > 0)
+		{
+			Instances->BatchUpdateInstancesTransforms(0, Archetype.InstanceTransforms, true, true, true);
+		}
+	}
+}
+#pragma endregion 시뮬레이션
+
+#pragma region 승격 / 강등
+void UBackgroundUnitSubsystem::GatherFocusPoints()
+{
+	FocusCells.Reset();
+	FocusCellSize = FMath::Max(CVarBackgroundPromoteRadius.GetValueOnGameThread() * CVarBackgroundDemoteScale.GetValueOnGameThread(), 1.f);
+
+	if (const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>())
+	{
+		const float InvCellSize = 1.f / FocusCellSize;
+		for (const FUnitGridEntry& Entry : Grid->GetEntries())
+		{
+			const ABaseUnit* Unit = Entry.Unit.Get();
+			if (!Unit || Unit->bIsDead || Entry.FactionIndex == INDEX_NONE) continue;
+
+			const int64 Key = BackgroundUnit::MakeCellKey(FMath::FloorToInt32(Entry.Location.X * InvCellSize), FMath::FloorToInt32(Entry.Location.Y * InvCellSize));
+			FocusCells.FindOrAdd(Key).Add({ Entry.Location, static_cast<uint8>(Entry.FactionIndex) });
+		}
+	}
+
+	const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+	bHasCamera = CameraManager != nullptr;
+	CameraLocation = bHasCamera ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+}
+
+bool UBackgroundUnitSubsystem::IsNearFocus(const FVector& Location, uint8 FactionId, float Scale) const
+{
+	if (bHasCamera && FVector::DistSquared(CameraLocation, Location) <= FMath::Square(CVarBackgroundCameraRadius.GetValueOnGameThread() * Scale))
+	{
+		return true;
+	}
+
+	const uint32 HostileMask = FParadiseFactionTable::Get().GetHostileMask(FactionId);
+	if (HostileMask == 0) return false;
+
+	// 셀 크기 = 강등 거리(가장 넓은 판정)이므로 주변 3x3 셀만 보면 됨
+	const float RadiusSq = FMath::Square(CVarBackgroundPromoteRadius.GetValueOnGameThread() * Scale);
+	const int32 CellX = FMath::FloorToInt32(Location.X / FocusCellSize);
+	const int32 CellY = FMath::FloorToInt32(Location.Y / FocusCellSize);
+
+	for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+	{
+		for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+		{
+			const TArray<FFocusPoint>* Points = FocusCells.Find(BackgroundUnit::MakeCellKey(CellX + OffsetX, CellY + OffsetY));
+			if (!Points) continue;
+
+			for (const FFocusPoint& Point : *Points)
+			{
+				if ((HostileMask & (1u << Point.FactionId)) != 0 && FVector::DistSquared2D(Point.Location, Location) <= RadiusSq)
+				{
+					return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+void UBackgroundUnitSubsystem::UpdateDemotions()
+{
+	const float DemoteScale = FMath::Max(CVarBackgroundDemoteScale.GetValueOnGameThread(), 1.f);
+	int32 Budget = CVarBackgroundMaxTransitions.GetValueOnGameThread();
+
+	for (int32 Index = Promoted.Num() - 1; Index >= 0; --Index)
+	{
+		// 죽어서(또는 다른 경로로) 풀에 돌아간 유닛은 추적만 끝냄
+		const ABaseUnit* Unit = Promoted[Index].Unit.Get();
+		if (!Unit || Unit->bIsDead || Unit->IsHidden())
+		{
+			Promoted.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// 꺼져 있으면 승격된 유닛은 액터로 유지
+		if (!IsEnabled() || Budget <= 0) continue;
+
+		if (!IsNearFocus(Unit->GetActorLocation(), Unit->FactionId, DemoteScale))
+		{
+			DemoteUnit(Index);
+			--Budget;
+		}
+	}
+}
+
+void UBackgroundUnitSubsystem::UpdatePromotions()
+{
+	// 꺼지면 거리와 상관없이 모두 액터로 돌려보냄 (예산은 그대로 적용)
+	const bool bPromoteAll = !IsEnabled();
+	const int32 MaxPromoted = CVarBackgroundMaxPromoted.GetValueOnGameThread();
+
+	int32 Budget = CVarBackgroundMaxTransitions.GetValueOnGameThread();
+	int32 Checks = FMath::Min(CVarBackgroundChecksPerFrame.GetValueOnGameThread(), Units.Num());
+
+	while (Checks-- > 0 && Budget > 0 && Units.Num() > 0 && (bPromoteAll || Promoted.Num() < MaxPromoted))
+	{
+		if (PromoteCursor >= Units.Num())
+		{
+			PromoteCursor = 0;
+		}
+
+		if ((bPromoteAll || IsNearFocus(Units.Location[PromoteCursor], Units.FactionId[PromoteCursor], 1.f)) && PromoteUnit(PromoteCursor))
+		{
+			// 마지막 유닛이 이 자리로 옮겨왔으므로 커서는 그대로
+			--Budget;
+			continue;
+		}
+		++PromoteCursor;
+	}
+}
+
+ABaseUnit* UBackgroundUnitSubsystem::PromoteUnit(int32 Index)
+{
+	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
+	if (!PoolSubsystem) return nullptr;
+
+	const uint16 ArchetypeIndex = Units.Archetype[Index];
+	const FBackgroundUnitArchetype& Archetype = Archetypes[ArchetypeIndex];
+	const FRotator Rotation(0.f, Units.Yaw[Index], 0.f);
+
+	ABaseUnit* Unit = PoolSubsystem->SpawnPoolActor<ABaseUnit>(Archetype.PoolHandle, Units.Location[Index], Rotation, nullptr, nullptr);
+	if (!Unit) return nullptr;
+
+	// 배경 유닛은 발 위치를 들고 있으므로 캡슐 절반 높이만큼 올려서 배치
+	const UCapsuleComponent* Capsule = Unit->GetCapsuleComponent();
+	const FVector SpawnLocation = Units.Location[Index] + FVector(0.f, 0.f, Capsule ? Capsule->GetScaledCapsuleHalfHeight() : 0.f);
+	Unit->SetActorLocationAndRotation(SpawnLocation, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+
+	Unit->SetUnitID(Archetype.RowName);
+	Unit->InitializeUnit(Archetype.Stats, Archetype.Assets);
+	Unit->HP = FMath::Min(Units.HP[Index], Unit->MaxHP);
+	Unit->StartAIBehavior(Archetype.Stats, Archetype.Assets);
+
+	FPromotedBackgroundUnit& Entry = Promoted.AddDefaulted_GetRef();
+	Entry.Unit = Unit;
+	Entry.Archetype = ArchetypeIndex;
+	Entry.TargetLocation = Units.TargetLocation[Index];
+
+	Units.RemoveAtSwap(Index);
+	INC_DWORD_STAT(STAT_Background_Promotions);
+	return Unit;
+}
+
+void UBackgroundUnitSubsystem::DemoteUnit(int32 PromotedIndex)
+{
+	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
+	ABaseUnit* Unit = Promoted[PromotedIndex].Unit.Get();
+	if (!PoolSubsystem || !Unit) return;
+
+	const UCapsuleComponent* Capsule = Unit->GetCapsuleComponent();
+	const FVector FootLocation = Unit->GetActorLocation() - FVector(0.f, 0.f, Capsule ? Capsule->GetScaledCapsuleHalfHeight() : 0.f);
+
+	Units.Add(FootLocation, Unit->GetActorRotation().Yaw, Unit->HP, Unit->FactionId, Promoted[PromotedIndex].Archetype, Promoted[PromotedIndex].TargetLocation);
+	Promoted.RemoveAtSwap(PromotedIndex, 1, EAllowShrinking::No);
+
+	PoolSubsystem->ReturnToPool(Unit);
+	INC_DWORD_STAT(STAT_Background_Demotions);
+}
+#pragma endregion 승격 / 강등
+
+void UBackgroundUnitSubsystem::DumpState() const
+{
+	UE_LOG(LogTemp, Log, TEXT("📊 [Background] 배경 유닛 %d / 승격 유닛 %d / 종류 %d (Enable=%d)"),
+		Units.Num(), Promoted.Num(), Archetypes.Num(), IsEnabled() ? 1 : 0);
+
+	TArray<int32> BackgroundCounts;
+	TArray<int32> PromotedCounts;
+	BackgroundCounts.SetNumZeroed(Archetypes.Num());
+	PromotedCounts.SetNumZeroed(Archetypes.Num());
+
+	for (const uint16 ArchetypeIndex : Units.Archetype)
+	{
+		++BackgroundCounts[ArchetypeIndex];
+	}
+	for (const FPromotedBackgroundUnit& Entry : Promoted)
+	{
+		++PromotedCounts[Entry.Archetype];
+	}
+
+	for (int32 Index = 0; Index < Archetypes.Num(); ++Index)
+	{
+		UE_LOG(LogTemp, Log, TEXT("   - %s : 배경 %d / 승격 %d"), *Archetypes[Index].RowName.ToString(), BackgroundCounts[Index], PromotedCounts[Index]);
+	}
+}
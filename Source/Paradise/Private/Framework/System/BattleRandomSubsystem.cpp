@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/BattleRandomSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+static TAutoConsoleVariable<int32> CVarBattleSeed(
+	TEXT("paradise.battle.Seed"),
+	0,
+	TEXT("전투 난수 시드. 0이 아니면 다음 스테이지부터 이 시드로 고정합니다. (성능 회귀 비교용, 0 = 시간 기반)"),
+	ECVF_Default);
+
+void UBattleRandomSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	StartBattle(ResolveSeed());
+}
+
+void UBattleRandomSubsystem::StartBattle(int32 InSeed)
+{
+	Seed = InSeed;
+
+	// 스트림마다 시드에서 파생한 값을 써서, 스트림끼리 같은 수열이 나오지 않게 함
+	for (uint8 Index = 0; Index < static_cast<uint8>(EBattleRandomStream::Count); ++Index)
+	{
+		Streams[Index].Initialize(static_cast<int32>(HashCombine(GetTypeHash(Seed), GetTypeHash(Index + 1))));
+	}
+
+	CSV_METADATA(TEXT("BattleSeed"), *FString::FromInt(Seed));
+
+	UE_LOG(LogTemp, Log, TEXT("🎲 [BattleRandom] 전투 시드: %d (재현: paradise.battle.Seed %d)"), Seed, Seed);
+}
+
+FRandomStream* UBattleRandomSubsystem::FindStream(const UObject* WorldContextObject, EBattleRandomStream Stream)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UBattleRandomSubsystem* BattleRandom = World ? World->GetSubsystem<UBattleRandomSubsystem>() : nullptr;
+
+	return BattleRandom ? &BattleRandom->GetStream(Stream) : nullptr;
+}
+
+int32 UBattleRandomSubsystem::ResolveSeed()
+{
+	const int32 FixedSeed = CVarBattleSeed.GetValueOnGameThread();
+	if (FixedSeed != 0) return FixedSeed;
+
+	// 0은 '지정 안 함'이므로 시간 기반 시드가 0이 되지 않게 함
+	const int32 TimeSeed = static_cast<int32>(FPlatformTime::Cycles());
+	return TimeSeed != 0 ? TimeSeed : 1;
+}
@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/CombatFXSubsystem.h"
+#include "Data/Assets/FXDataAsset.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Camera/PlayerCameraManager.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Sound/SoundBase.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseFX"), STATGROUP_ParadiseFX, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("PlayCombatFX"), STAT_FX_Play, STATGROUP_ParadiseFX);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("VFX Spawned / Frame"), STAT_FX_VFXSpawned, STATGROUP_ParadiseFX);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Played / Frame"), STAT_FX_SFXPlayed, STATGROUP_ParadiseFX);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped (Not Loaded) / Frame"), STAT_FX_SkippedNotLoaded, STATGROUP_ParadiseFX);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped (Frame Budget) / Frame"), STAT_FX_SkippedBudget, STATGROUP_ParadiseFX);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Skipped (Tag Cap) / Frame"), STAT_FX_SkippedCap, STATGROUP_ParadiseFX);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SFX Distance Culled / Frame"), STAT_FX_SFXCulled, STATGROUP_ParadiseFX);
+
+static TAutoConsoleVariable<int32> CVarFXMaxSpawnsPerFrame(
+	TEXT("paradise.fx.MaxSpawnsPerFrame"),
+	16,
+	TEXT("프레임당 생성할 수 있는 전투 VFX 최대 개수. 넘는 요청은 생략합니다. (0 = 무제한)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFXDefaultMaxConcurrent(
+	TEXT("paradise.fx.DefaultMaxConcurrent"),
+	8,
+	TEXT("FCombatFXSet::MaxConcurrent가 0인 태그의 동시 재생 최대 개수. (0 = 무제한)"),
+	ECVF_Default);
+
+void UCombatFXSubsystem::Deinitialize()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	PreloadHandles.Reset();
+	PreloadedData.Reset();
+	ActiveEffects.Reset();
+	EffectOwnerTags.Reset();
+
+	Super::Deinitialize();
+}
+
+void UCombatFXSubsystem::PreloadFXData(UFXDataAsset* FXData)
+{
+	if (!FXData || PreloadedData.Contains(FXData)) return;
+	PreloadedData.Add(FXData);
+
+	TArray<FSoftObjectPath> AssetPaths;
+	FXData->GetAllAssetPaths(AssetPaths);
+	if (AssetPaths.Num() == 0) return;
+
+	UE_LOG(LogTemp, Log, TEXT("📦 [CombatFX] 비동기 프리로드 시작: %s (%d개)"), *FXData->GetName(), AssetPaths.Num());
+
+	// 핸들을 들고 있는 동안 에셋이 GC되지 않으므로 월드가 끝날 때까지 보관합니다.
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	if (Handle.IsValid())
+	{
+		PreloadHandles.Add(Handle);
+	}
+}
+
+bool UCombatFXSubsystem::IsPreloadComplete() const
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UCombatFXSubsystem::PlayCombatFX(UFXDataAsset* FXData, const FGameplayTag& Tag, const FVector& Location)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FX_Play);
+
+	if (!FXData) return false;
+
+	const FCombatFXSet* FoundFX = FXData->FindEffect(Tag);
+	if (!FoundFX) return false;
+
+	// 스테이지에서 프리로드하지 않은 에셋이면 지금부터 비동기 로드 (이번 재생은 생략될 수 있음)
+	PreloadFXData(FXData);
+
+	UWorld* World = GetWorld();
+
+	// (A) 나이아가라 재생 (로드된 경우에만, 컴포넌트 풀 사용)
+	if (!FoundFX->VisualEffect.IsNull())
+	{
+		UNiagaraSystem* VFX = FoundFX->VisualEffect.Get();
+		const int32 MaxConcurrent = FoundFX->MaxConcurrent > 0 ? FoundFX->MaxConcurrent : CVarFXDefaultMaxConcurrent.GetValueOnGameThread();
+
+		if (!VFX)
+		{
+			INC_DWORD_STAT(STAT_FX_SkippedNotLoaded);
+		}
+		else if (!HasConcurrencySlot(Tag, MaxConcurrent))
+		{
+			INC_DWORD_STAT(STAT_FX_SkippedCap);
+		}
+		else if (!ConsumeFrameBudget())
+		{
+			INC_DWORD_STAT(STAT_FX_SkippedBudget);
+		}
+		else if (UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			World,
+			VFX,
+			Location + FoundFX->LocationOffset,
+			FRotator::ZeroRotator,
+			FoundFX->Scale,
+			true,
+			true,
+			ENCPoolMethod::AutoRelease))
+		{
+			TrackActiveEffect(NiagaraComp, Tag, MaxConcurrent > 0);
+			INC_DWORD_STAT(STAT_FX_VFXSpawned);
+		}
+	}
+
+	// (B) 사운드 재생 (로드된 경우에만, 거리 컬링 + 동시 재생 제한)
+	if (!FoundFX->SoundEffect.IsNull())
+	{
+		USoundBase* SFX = FoundFX->SoundEffect.Get();
+		if (!SFX)
+		{
+			INC_DWORD_STAT(STAT_FX_SkippedNotLoaded);
+			return true;
+		}
+
+		if (FoundFX->MaxAudibleDistance > 0.f)
+		{
+			const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(World, 0);
+			if (CameraManager && FVector::DistSquared(CameraManager->GetCameraLocation(), Location) > FMath::Square(FoundFX->MaxAudibleDistance))
+			{
+				INC_DWORD_STAT(STAT_FX_SFXCulled);
+				return true;
+			}
+		}
+
+		UGameplayStatics::PlaySoundAtLocation(World, SFX, Location, 1.f, 1.f, 0.f, nullptr, FXData->SoundConcurrency);
+		INC_DWORD_STAT(STAT_FX_SFXPlayed);
+	}
+
+	return true;
+}
+
+bool UCombatFXSubsystem::ConsumeFrameBudget()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SpawnsThisFrame = 0;
+	}
+
+	const int32 MaxSpawns = CVarFXMaxSpawnsPerFrame.GetValueOnGameThread();
+	if (MaxSpawns > 0 && SpawnsThisFrame >= MaxSpawns) return false;
+
+	++SpawnsThisFrame;
+	return true;
+}
+
+bool UCombatFXSubsystem::HasConcurrencySlot(const FGameplayTag& Tag, int32 MaxConcurrent)
+{
+	if (MaxConcurrent <= 0) return true;
+
+	TArray<TWeakObjectPtr<UNiagaraComponent>>* Active = ActiveEffects.Find(Tag);
+	if (!Active) return true;
+
+	// 재생이 끝나 풀로 돌아간(비활성) 컴포넌트 정리
+	Active->RemoveAllSwap([this](const TWeakObjectPtr<UNiagaraComponent>& Comp)
+	{
+		const bool bFinished = !Comp.IsValid() || !Comp->IsActive();
+		if (bFinished)
+		{
+			EffectOwnerTags.Remove(Comp);
+		}
+		return bFinished;
+	}, EAllowShrinking::No);
+
+	return Active->Num() < MaxConcurrent;
+}
+
+void UCombatFXSubsystem::TrackActiveEffect(UNiagaraComponent* NiagaraComp, const FGameplayTag& Tag, bool bCounted)
+{
+	const TWeakObjectPtr<UNiagaraComponent> CompKey(NiagaraComp);
+
+	// 풀에서 다시 꺼낸 컴포넌트가 이전 태그 목록에 남아 있으면 빼서 중복 집계를 막음
+	FGameplayTag PreviousTag;
+	if (EffectOwnerTags.RemoveAndCopyValue(CompKey, PreviousTag))
+	{
+		if (TArray<TWeakObjectPtr<UNiagaraComponent>>* Previous = ActiveEffects.Find(PreviousTag))
+		{
+			Previous->RemoveSingleSwap(CompKey, EAllowShrinking::No);
+		}
+	}
+
+	if (!bCounted) return;
+
+	ActiveEffects.FindOrAdd(Tag).Add(CompKey);
+	EffectOwnerTags.Add(CompKey, Tag);
+}
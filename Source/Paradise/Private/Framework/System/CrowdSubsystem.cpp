@@ -0,0 +1,273 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/CrowdSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Data/Assets/CrowdConfig.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseCrowd"), STATGROUP_ParadiseCrowd, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Crowd Total"), STAT_Crowd_Tick, STATGROUP_ParadiseCrowd);
+DECLARE_CYCLE_STAT(TEXT("Snapshot"), STAT_Crowd_Snapshot, STATGROUP_ParadiseCrowd);
+DECLARE_CYCLE_STAT(TEXT("Solve"), STAT_Crowd_Solve, STATGROUP_ParadiseCrowd);
+DECLARE_CYCLE_STAT(TEXT("Apply"), STAT_Crowd_Apply, STATGROUP_ParadiseCrowd);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Agents"), STAT_Crowd_Agents, STATGROUP_ParadiseCrowd);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overlapping Agents / Frame"), STAT_Crowd_Overlapping, STATGROUP_ParadiseCrowd);
+
+static TAutoConsoleVariable<int32> CVarCrowdEnable(
+	TEXT("paradise.crowd.Enable"),
+	1,
+	TEXT("1이면 AI 유닛끼리 캡슐 충돌 대신 군중 분리/회피를 사용합니다. 0이면 기존 Pawn 충돌로 되돌립니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCrowdParallel(
+	TEXT("paradise.crowd.Parallel"),
+	1,
+	TEXT("1이면 군중 회피 계산을 여러 스레드로 나눕니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdTimeHorizon(
+	TEXT("paradise.crowd.TimeHorizon"),
+	0.75f,
+	TEXT("이 시간(초) 안에 부딪힐 이웃을 미리 피합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdAvoidanceWeight(
+	TEXT("paradise.crowd.AvoidanceWeight"),
+	1.0f,
+	TEXT("예측 회피 세기. 0이면 겹침 분리만 합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCrowdMaxPush(
+	TEXT("paradise.crowd.MaxPushPerFrame"),
+	8.f,
+	TEXT("겹침 분리로 한 프레임에 옮길 수 있는 최대 거리(cm)."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GCrowdStressCommand(
+	TEXT("paradise.crowd.stress"),
+	TEXT("플레이어 주변에 유닛 N개를 스폰해 한 점으로 몰리게 합니다. 부하는 'stat ParadiseCrowd'로 확인. (0 = 정리)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UCrowdSubsystem* Crowd = World ? World->GetSubsystem<UCrowdSubsystem>() : nullptr;
+		if (!Crowd) return;
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500;
+		Crowd->StartStressTest(Count);
+	}));
+
+void UCrowdSubsystem::Deinitialize()
+{
+	StressUnits.Reset();
+	SnapshotUnits.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCrowdSubsystem, STATGROUP_Tickables);
+}
+
+bool UCrowdSubsystem::IsEnabled()
+{
+	return CVarCrowdEnable.GetValueOnGameThread() != 0;
+}
+
+void UCrowdSubsystem::SetConfig(const UCrowdConfig* InConfig)
+{
+	if (InConfig)
+	{
+		DefaultSettings = InConfig->DefaultSettings;
+		RoleSettings = InConfig->RoleSettings;
+	}
+	else
+	{
+		DefaultSettings = FCrowdAgentSettings();
+		RoleSettings.Reset();
+	}
+}
+
+const FCrowdAgentSettings& UCrowdSubsystem::GetAgentSettings(const FGameplayTag& RoleTag) const
+{
+	const FCrowdAgentSettings* Found = RoleTag.IsValid() ? RoleSettings.Find(RoleTag) : nullptr;
+	return Found ? *Found : DefaultSettings;
+}
+
+void UCrowdSubsystem::ApplyCrowdCollision(ABaseUnit* Unit) const
+{
+	UCapsuleComponent* Capsule = Unit ? Unit->GetCapsuleComponent() : nullptr;
+	const UCharacterMovementComponent* MoveComp = Unit ? Unit->GetCharacterMovement() : nullptr;
+	if (!Capsule || !MoveComp || MoveComp->MovementMode == MOVE_None) return;
+
+	if (IsEnabled())
+	{
+		Capsule->SetCollisionObjectType(ECC_CrowdUnit);
+		Capsule->SetCollisionResponseToChannel(ECC_CrowdUnit, ECR_Ignore);
+	}
+	else
+	{
+		Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionResponseToChannel(ECC_CrowdUnit, ECR_Block);
+	}
+}
+
+void UCrowdSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Crowd_Tick);
+
+	Super::Tick(DeltaTime);
+
+	SyncCollisionMode();
+	TickStressTest();
+
+	if (!IsEnabled()) return;
+
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	if (!Grid) return;
+
+	// 1. 스냅샷: 격자에 등록된 유닛 중 CrowdUnit 채널로 걷고 있는 유닛만
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Crowd_Snapshot);
+
+		const TArray<FUnitGridEntry>& Entries = Grid->GetEntries();
+		Snapshot.Reset(Entries.Num());
+		SnapshotUnits.Reset(Entries.Num());
+
+		for (const FUnitGridEntry& Entry : Entries)
+		{
+			ABaseUnit* Unit = Entry.Unit.Get();
+			if (!Unit || Unit->bIsDead || Unit->IsHidden()) continue;
+
+			const UCapsuleComponent* Capsule = Unit->GetCapsuleComponent();
+			const UCharacterMovementComponent* MoveComp = Unit->GetCharacterMovement();
+			if (!Capsule || !MoveComp || !MoveComp->IsMovingOnGround() || Capsule->GetCollisionObjectType() != ECC_CrowdUnit) continue;
+
+			const FCrowdAgentSettings& Settings = GetAgentSettings(Unit->RoleTypeTag);
+			Snapshot.Add(Unit->GetActorLocation(), MoveComp->Velocity, Settings.Radius, Settings.Priority);
+			SnapshotUnits.Add(Unit);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Crowd_Agents, Snapshot.Num());
+	if (Snapshot.Num() == 0) return;
+
+	// 2. 계산
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Crowd_Solve);
+
+		FCrowdAvoidanceParams Params;
+		Params.TimeHorizon = CVarCrowdTimeHorizon.GetValueOnGameThread();
+		Params.AvoidanceWeight = CVarCrowdAvoidanceWeight.GetValueOnGameThread();
+		Params.MaxPushPerFrame = CVarCrowdMaxPush.GetValueOnGameThread();
+
+		FCrowdAvoidanceSolver::Solve(Snapshot, Params, Results, CVarCrowdParallel.GetValueOnGameThread() != 0);
+	}
+
+	SET_DWORD_STAT(STAT_Crowd_Overlapping, Results.NumOverlapping);
+
+	// 3. 적용: 겹침은 위치로 바로 풀고, 회피는 속도로 넘겨 다음 무브먼트 틱이 이어받게 함
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Crowd_Apply);
+
+		for (int32 Slot = 0; Slot < SnapshotUnits.Num(); ++Slot)
+		{
+			ABaseUnit* Unit = SnapshotUnits[Slot];
+
+			const FVector2f& Push = Results.Push[Slot];
+			if (Push.SizeSquared() > 1.f)
+			{
+				// 스윕 없이 옮김 (보정량이 작고, 지형 관통은 다음 무브먼트 틱에서 해소)
+				Unit->SetActorLocation(Unit->GetActorLocation() + FVector(Push.X, Push.Y, 0.f));
+			}
+
+			UCharacterMovementComponent* MoveComp = Unit->GetCharacterMovement();
+			const FVector2f& NewVelocity = Results.Velocity[Slot];
+			MoveComp->Velocity.X = NewVelocity.X;
+			MoveComp->Velocity.Y = NewVelocity.Y;
+		}
+	}
+
+	SnapshotUnits.Reset();
+}
+
+void UCrowdSubsystem::SyncCollisionMode()
+{
+	const bool bEnabled = IsEnabled();
+	if (bEnabled == bCollisionModeApplied) return;
+
+	bCollisionModeApplied = bEnabled;
+
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	if (!Grid) return;
+
+	for (const FUnitGridEntry& Entry : Grid->GetEntries())
+	{
+		ApplyCrowdCollision(Entry.Unit.Get());
+	}
+}
+
+#pragma region 부하 측정
+void UCrowdSubsystem::StartStressTest(int32 Count)
+{
+	StopStressTest();
+	if (Count <= 0) return;
+
+	UWorld* World = GetWorld();
+	const APlayerController* PC = World->GetFirstPlayerController();
+	const APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr;
+	StressCenter = PlayerPawn ? PlayerPawn->GetActorLocation() + PlayerPawn->GetActorForwardVector() * 1500.f : FVector::ZeroVector;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	// 중심을 둘러싼 고리에 고르게 배치
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const float Angle = UE_TWO_PI * Index / Count;
+		const float Distance = FMath::FRandRange(1500.f, 3000.f);
+		const FVector Location = StressCenter + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * Distance + FVector(0.f, 0.f, 100.f);
+
+		ABaseUnit* Unit = World->SpawnActor<ABaseUnit>(ABaseUnit::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+		if (!Unit) continue;
+
+		ApplyCrowdCollision(Unit);
+		StressUnits.Add(Unit);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("👥 [Crowd] 부하 측정 시작: 유닛 %d개 (군중 회피 %s)"), StressUnits.Num(), IsEnabled() ? TEXT("ON") : TEXT("OFF"));
+}
+
+void UCrowdSubsystem::StopStressTest()
+{
+	for (const TWeakObjectPtr<ABaseUnit>& Unit : StressUnits)
+	{
+		if (Unit.IsValid())
+		{
+			Unit->Destroy();
+		}
+	}
+	StressUnits.Reset();
+}
+
+void UCrowdSubsystem::TickStressTest()
+{
+	for (const TWeakObjectPtr<ABaseUnit>& Unit : StressUnits)
+	{
+		AAIController* AIController = Unit.IsValid() ? Cast<AAIController>(Unit->GetController()) : nullptr;
+		if (!AIController || AIController->GetMoveStatus() != EPathFollowingStatus::Idle) continue;
+
+		// 도착했거나 밀려난 유닛도 계속 중심으로 파고들게 함
+		AIController->MoveToLocation(StressCenter, 5.f);
+	}
+}
+#pragma endregion 부하 측정
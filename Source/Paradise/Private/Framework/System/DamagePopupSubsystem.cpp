@@ -0,0 +1,311 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/DamagePopupSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/GameViewportClient.h"
+#include "GameFramework/PlayerController.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Widgets/SLeafWidget.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadisePopup"), STATGROUP_ParadisePopup, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Tick (Project)"), STAT_Popup_Tick, STATGROUP_ParadisePopup);
+DECLARE_CYCLE_STAT(TEXT("Paint"), STAT_Popup_Paint, STATGROUP_ParadisePopup);
+DECLARE_CYCLE_STAT(TEXT("AddDamagePopup"), STAT_Popup_Add, STATGROUP_ParadisePopup);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Requests / Frame"), STAT_Popup_Requests, STATGROUP_ParadisePopup);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Merged / Frame"), STAT_Popup_Merged, STATGROUP_ParadisePopup);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Overwritten / Frame"), STAT_Popup_Overwritten, STATGROUP_ParadisePopup);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Drawn"), STAT_Popup_Drawn, STATGROUP_ParadisePopup);
+
+static TAutoConsoleVariable<int32> CVarPopupMaxCount(
+	TEXT("paradise.popup.MaxCount"),
+	256,
+	TEXT("동시에 표시할 수 있는 데미지 숫자 최대 개수 (링 버퍼 크기). 넘으면 가장 오래된 숫자를 덮어씁니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPopupLifetime(
+	TEXT("paradise.popup.Lifetime"),
+	0.8f,
+	TEXT("데미지 숫자 표시 시간 (초)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPopupRiseSpeed(
+	TEXT("paradise.popup.RiseSpeed"),
+	80.0f,
+	TEXT("데미지 숫자가 떠오르는 속도 (화면 단위/초)"),
+	ECVF_Default);
+
+namespace DamagePopupStyle
+{
+	static const FSlateFontInfo& GetFont(bool bCritical)
+	{
+		static FSlateFontInfo NormalFont = []()
+		{
+			FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Bold", 18);
+			Font.OutlineSettings.OutlineSize = 2;
+			return Font;
+		}();
+
+		static FSlateFontInfo CriticalFont = []()
+		{
+			FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Bold", 26);
+			Font.OutlineSettings.OutlineSize = 2;
+			return Font;
+		}();
+
+		return bCritical ? CriticalFont : NormalFont;
+	}
+
+	static const FLinearColor NormalColor = FLinearColor::White;
+	static const FLinearColor CriticalColor = FLinearColor(1.0f, 0.75f, 0.1f);
+
+	/** @brief 치명타 숫자가 처음 커졌다가 줄어드는 시간 (초) */
+	static constexpr float CriticalPopTime = 0.15f;
+
+	/** @brief 수명 중 서서히 사라지기 시작하는 비율 */
+	static constexpr float FadeStartRatio = 0.7f;
+}
+
+/**
+ * @brief 데미지 숫자를 한 번에 그리는 뷰포트 레이어
+ * @details 서브시스템이 Tick에서 투영해둔 목록을 그리기만 합니다. 입력은 받지 않습니다.
+ */
+class SDamagePopupLayer : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SDamagePopupLayer) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, UDamagePopupSubsystem* InOwner)
+	{
+		OwnerSubsystem = InOwner;
+		SetVisibility(EVisibility::HitTestInvisible);
+	}
+
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Popup_Paint);
+
+		const UDamagePopupSubsystem* Subsystem = OwnerSubsystem.Get();
+		if (!Subsystem) return LayerId;
+
+		const TArray<FDamagePopupDrawItem>& DrawItems = Subsystem->GetDrawItems();
+		SET_DWORD_STAT(STAT_Popup_Drawn, DrawItems.Num());
+
+		for (const FDamagePopupDrawItem& Item : DrawItems)
+		{
+			if (!Subsystem->IsValidEntryIndex(Item.EntryIndex)) continue;
+
+			const FDamagePopupEntry& Entry = Subsystem->GetEntry(Item.EntryIndex);
+			const FSlateFontInfo& Font = DamagePopupStyle::GetFont(Entry.bCritical);
+
+			FLinearColor Color = Entry.bCritical ? DamagePopupStyle::CriticalColor : DamagePopupStyle::NormalColor;
+			Color.A = Item.Alpha;
+
+			// 가운데 정렬: 측정해둔 너비의 절반만큼 왼쪽으로
+			const FVector2f Offset(Item.Position.X - Entry.TextWidth * 0.5f * Item.Scale, Item.Position.Y);
+			FSlateDrawElement::MakeText(
+				OutDrawElements,
+				LayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2f(Entry.TextWidth, Font.Size), FSlateLayoutTransform(Item.Scale, Offset)),
+				Entry.Text,
+				Font,
+				ESlateDrawEffect::None,
+				Color * InWidgetStyle.GetColorAndOpacityTint());
+		}
+
+		return LayerId;
+	}
+
+private:
+	TWeakObjectPtr<UDamagePopupSubsystem> OwnerSubsystem;
+};
+
+bool UDamagePopupSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDamagePopupSubsystem::Deinitialize()
+{
+	if (Layer.IsValid())
+	{
+		if (UGameViewportClient* GameViewport = GetWorld() ? GetWorld()->GetGameViewport() : nullptr)
+		{
+			GameViewport->RemoveViewportWidgetContent(Layer.ToSharedRef());
+		}
+		Layer.Reset();
+	}
+
+	Entries.Reset();
+	DrawItems.Reset();
+	FrameMergeMap.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UDamagePopupSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamagePopupSubsystem, STATGROUP_Tickables);
+}
+
+void UDamagePopupSubsystem::AddDamagePopup(AActor* Target, float DamageAmount, bool bIsCritical)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Popup_Add);
+
+	if (!IsValid(Target) || DamageAmount <= 0.f) return;
+
+	// 뷰포트가 없는 환경(데디케이티드 서버 등)에서는 아무것도 하지 않습니다.
+	if (!EnsureLayer()) return;
+
+	INC_DWORD_STAT(STAT_Popup_Requests);
+
+	// 같은 프레임에 같은 대상이 맞았다면 기존 숫자에 합산
+	if (FrameMergeFrame != GFrameCounter)
+	{
+		FrameMergeMap.Reset();
+		FrameMergeFrame = GFrameCounter;
+	}
+
+	if (const int32* Found = FrameMergeMap.Find(Target))
+	{
+		FDamagePopupEntry& Merged = Entries[*Found];
+		// 한 프레임에 링이 한 바퀴 돌면 슬롯이 다른 대상에게 재사용됐을 수 있으므로 대상도 확인
+		if (Merged.bActive && Merged.SpawnFrame == GFrameCounter && Merged.Target == TObjectKey<AActor>(Target))
+		{
+			Merged.Damage += DamageAmount;
+			Merged.bCritical |= bIsCritical;
+			FormatEntry(Merged);
+			INC_DWORD_STAT(STAT_Popup_Merged);
+			return;
+		}
+	}
+
+	const int32 Capacity = FMath::Max(CVarPopupMaxCount.GetValueOnGameThread(), 1);
+	if (Entries.Num() != Capacity)
+	{
+		// 용량이 바뀌면 버퍼를 새로 만듭니다. (CVar 변경 시에만 발생)
+		Entries.Reset();
+		Entries.SetNum(Capacity);
+		Head = 0;
+		NumAlive = 0;
+		FrameMergeMap.Reset();
+
+		// 이전 버퍼 인덱스를 들고 있으므로 다음 Tick까지 그리지 않음
+		DrawItems.Reset();
+	}
+
+	const int32 Index = Head;
+	Head = (Head + 1) % Capacity;
+
+	FDamagePopupEntry& Entry = Entries[Index];
+	if (Entry.bActive)
+	{
+		INC_DWORD_STAT(STAT_Popup_Overwritten);
+
+		// 덮어쓰는 슬롯을 가리키던 이번 프레임 합산 항목 제거
+		const int32* Stale = FrameMergeMap.Find(Entry.Target);
+		if (Stale && *Stale == Index)
+		{
+			FrameMergeMap.Remove(Entry.Target);
+		}
+	}
+	else
+	{
+		++NumAlive;
+	}
+
+	Entry.WorldLocation = Target->GetActorLocation() + FVector(0.f, 0.f, Target->GetSimpleCollisionHalfHeight());
+	Entry.Target = Target;
+	Entry.Damage = DamageAmount;
+	Entry.Age = 0.f;
+	Entry.JitterX = FMath::FRandRange(-20.f, 20.f);
+	Entry.SpawnFrame = GFrameCounter;
+	Entry.bCritical = bIsCritical;
+	Entry.bActive = true;
+	FormatEntry(Entry);
+
+	FrameMergeMap.Add(Target, Index);
+}
+
+void UDamagePopupSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Popup_Tick);
+
+	Super::Tick(DeltaTime);
+
+	DrawItems.Reset();
+	if (NumAlive == 0) return;
+
+	APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const float Lifetime = FMath::Max(CVarPopupLifetime.GetValueOnGameThread(), KINDA_SMALL_NUMBER);
+	const float RiseSpeed = CVarPopupRiseSpeed.GetValueOnGameThread();
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FDamagePopupEntry& Entry = Entries[Index];
+		if (!Entry.bActive) continue;
+
+		Entry.Age += DeltaTime;
+		if (Entry.Age >= Lifetime)
+		{
+			Entry.bActive = false;
+			--NumAlive;
+			continue;
+		}
+
+		// 화면 밖(카메라 뒤 포함)이면 이번 프레임은 그리지 않음
+		FVector2D ScreenPosition;
+		if (!PC || !UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(PC, Entry.WorldLocation, ScreenPosition, false))
+		{
+			continue;
+		}
+
+		const float LifeRatio = Entry.Age / Lifetime;
+
+		FDamagePopupDrawItem& Item = DrawItems.AddDefaulted_GetRef();
+		Item.EntryIndex = Index;
+		Item.Position = FVector2D(ScreenPosition.X + Entry.JitterX, ScreenPosition.Y - Entry.Age * RiseSpeed);
+		Item.Alpha = LifeRatio < DamagePopupStyle::FadeStartRatio
+			? 1.f
+			: 1.f - (LifeRatio - DamagePopupStyle::FadeStartRatio) / (1.f - DamagePopupStyle::FadeStartRatio);
+		Item.Scale = (Entry.bCritical && Entry.Age < DamagePopupStyle::CriticalPopTime)
+			? 1.f + 0.5f * (1.f - Entry.Age / DamagePopupStyle::CriticalPopTime)
+			: 1.f;
+	}
+}
+
+bool UDamagePopupSubsystem::EnsureLayer()
+{
+	if (Layer.IsValid()) return true;
+
+	UGameViewportClient* GameViewport = GetWorld()->GetGameViewport();
+	if (!GameViewport || !FSlateApplication::IsInitialized()) return false;
+
+	Layer = SNew(SDamagePopupLayer, this);
+	// HUD 위젯보다 아래, 월드보다는 위에 그리도록 낮은 ZOrder 사용
+	GameViewport->AddViewportWidgetContent(Layer.ToSharedRef(), -10);
+	return true;
+}
+
+void UDamagePopupSubsystem::FormatEntry(FDamagePopupEntry& Entry)
+{
+	Entry.Text = FString::FromInt(FMath::RoundToInt(Entry.Damage));
+
+	// 문자열이 바뀔 때만 측정 (매 프레임 측정하지 않음)
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	Entry.TextWidth = FontMeasure->Measure(Entry.Text, DamagePopupStyle::GetFont(Entry.bCritical)).X;
+}
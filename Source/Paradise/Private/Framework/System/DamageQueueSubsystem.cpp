@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/DamageQueueSubsystem.h"
+#include "Framework/System/DamagePopupSubsystem.h"
+#include "Framework/System/BattleRandomSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "Engine/World.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseDamage"), STATGROUP_ParadiseDamage, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Resolve"), STAT_Damage_Resolve, STATGROUP_ParadiseDamage);
+DECLARE_CYCLE_STAT(TEXT("Deaths"), STAT_Damage_Deaths, STATGROUP_ParadiseDamage);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Records / Frame"), STAT_Damage_Records, STATGROUP_ParadiseDamage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targets / Frame"), STAT_Damage_Targets, STATGROUP_ParadiseDamage);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deaths / Frame"), STAT_Damage_DeathCount, STATGROUP_ParadiseDamage);
+
+void UDamageQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 모든 액터(BT 포함) 틱이 끝난 뒤 한 번에 해결
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UDamageQueueSubsystem::OnWorldPostActorTick);
+}
+
+void UDamageQueueSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Records.Reset();
+	Aggregated.Reset();
+	AggregatedIndex.Reset();
+	Deaths.Reset();
+	OnUnitDamaged.Clear();
+
+	Super::Deinitialize();
+}
+
+void UDamageQueueSubsystem::PostDamage(const FDamageRecord& Record)
+{
+	if (!Record.Target.IsValid()) return;
+
+	Records.Add(Record);
+}
+
+void UDamageQueueSubsystem::PostAttack(ABaseUnit* Source, ABaseUnit* Target, float Multiplier, const FGameplayTag& DamageTag)
+{
+	if (!Source || !Target) return;
+
+	FDamageRecord& Record = Records.AddDefaulted_GetRef();
+	Record.Source = Source;
+	Record.Target = Target;
+	Record.AttackPower = Source->GetAttackPower();
+	Record.Multiplier = Multiplier;
+	Record.CritRate = Source->GetCritRate();
+	Record.DamageTag = DamageTag;
+}
+
+void UDamageQueueSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld()) return;
+
+	ResolvePendingDamage();
+}
+
+void UDamageQueueSubsystem::ResolvePendingDamage()
+{
+	if (Records.IsEmpty()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Damage_Resolve);
+	SET_DWORD_STAT(STAT_Damage_Records, Records.Num());
+
+	// 치명타는 전투 시드 스트림에서 게시 순서대로 굴림 (같은 시드면 같은 결과)
+	FRandomStream* CritStream = UBattleRandomSubsystem::FindStream(this, EBattleRandomStream::Crit);
+
+	// 1) 게시 순서대로 대상별 합산 (대상 순서 = 처음 맞은 순서)
+	Aggregated.Reset();
+	AggregatedIndex.Reset();
+
+	for (const FDamageRecord& Record : Records)
+	{
+		ABaseUnit* Target = Record.Target.Get();
+		if (!Target || Target->bIsDead) continue;
+
+		int32& Slot = AggregatedIndex.FindOrAdd(Target, INDEX_NONE);
+		if (Slot == INDEX_NONE)
+		{
+			Slot = Aggregated.AddDefaulted();
+			Aggregated[Slot].Target = Target;
+		}
+
+		const bool bCritical = ParadiseCombat::RollCritical(Record.CritRate, CritStream ? CritStream->GetFraction() : FMath::FRand());
+		const float Damage = ParadiseCombat::ComputeDamage(Record.AttackPower, Record.Multiplier, Target->GetDefense(), bCritical, Record.CritDamage);
+
+		FAggregatedDamage& Entry = Aggregated[Slot];
+		Entry.Damage += Damage;
+		Entry.bCritical |= bCritical;
+		if (Damage > Entry.LargestHit)
+		{
+			Entry.LargestHit = Damage;
+			Entry.Instigator = Record.Source.Get();
+			Entry.DamageTag = Record.DamageTag;
+		}
+	}
+
+	// 해결 중(사망 알림 등)에 새로 게시된 기록은 다음 프레임에 처리
+	Records.Reset();
+
+	// 2) HP 반영 (사망 처리는 모두 반영한 뒤)
+	Deaths.Reset();
+	UDamagePopupSubsystem* PopupSubsystem = GetWorld()->GetSubsystem<UDamagePopupSubsystem>();
+
+	for (const FAggregatedDamage& Entry : Aggregated)
+	{
+		if (Entry.Target->ApplyQueuedDamage(Entry.Damage))
+		{
+			Deaths.Add(Entry.Target);
+		}
+
+		if (PopupSubsystem)
+		{
+			PopupSubsystem->AddDamagePopup(Entry.Target, Entry.Damage, Entry.bCritical);
+		}
+
+		OnUnitDamaged.Broadcast(Entry.Target, Entry.Instigator, Entry.Damage, Entry.DamageTag);
+	}
+
+	SET_DWORD_STAT(STAT_Damage_Targets, Aggregated.Num());
+
+	// 3) 사망 처리 (블랙보드 정리, 풀 반납)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Damage_Deaths);
+		SET_DWORD_STAT(STAT_Damage_DeathCount, Deaths.Num());
+
+		for (ABaseUnit* Dead : Deaths)
+		{
+			Dead->Die();
+		}
+	}
+
+	Aggregated.Reset();
+	AggregatedIndex.Reset();
+	Deaths.Reset();
+}
@@ -0,0 +1,625 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "Objects/HomeBase.h"
+#include "AI/MonsterAI.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavigationSystemTypes.h"
+#include "GameFramework/PlayerController.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseFlow"), STATGROUP_ParadiseFlow, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Build Field (Sliced)"), STAT_Flow_Build, STATGROUP_ParadiseFlow);
+DECLARE_CYCLE_STAT(TEXT("Steer Followers"), STAT_Flow_Follow, STATGROUP_ParadiseFlow);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Followers"), STAT_Flow_Followers, STATGROUP_ParadiseFlow);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Field Cells"), STAT_Flow_Cells, STATGROUP_ParadiseFlow);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Fallbacks To Pathfinding / Frame"), STAT_Flow_Fallbacks, STATGROUP_ParadiseFlow);
+DECLARE_DWORD_COUNTER_STAT(TEXT("MoveTo Paths From Field / Frame"), STAT_Flow_MovePaths, STATGROUP_ParadiseFlow);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Build Time (s)"), STAT_Flow_LastBuildSeconds, STATGROUP_ParadiseFlow);
+
+static TAutoConsoleVariable<int32> CVarFlowEnable(
+	TEXT("paradise.nav.flow.Enable"),
+	1,
+	TEXT("1이면 HomeBase로 향하는 적이 개별 경로 탐색 대신 흐름장을 따릅니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowCellSize(
+	TEXT("paradise.nav.flow.CellSize"),
+	200.f,
+	TEXT("흐름장 셀 크기(cm). 다음 재계산부터 적용됩니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowExtent(
+	TEXT("paradise.nav.flow.Extent"),
+	12000.f,
+	TEXT("HomeBase 중심으로 흐름장을 계산할 반경(cm, 정사각형 절반 크기)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFlowCellsPerFrame(
+	TEXT("paradise.nav.flow.CellsPerFrame"),
+	500,
+	TEXT("프레임당 네비메시에 투영할 셀 수. 다익스트라/방향 계산은 이 값의 8배를 처리합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowMaxHeightStep(
+	TEXT("paradise.nav.flow.MaxHeightStep"),
+	120.f,
+	TEXT("이웃 셀 사이 높이 차가 이 값(cm)보다 크면 이동할 수 없는 것으로 봅니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowArrivalRadius(
+	TEXT("paradise.nav.flow.ArrivalRadius"),
+	300.f,
+	TEXT("HomeBase까지 이 거리(cm) 안으로 들어오면 흐름장 추종을 끝냅니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFlowDebugDraw(
+	TEXT("paradise.nav.flow.DebugDraw"),
+	0,
+	TEXT("1이면 플레이어 주변 흐름장 방향을 화살표로 그립니다."),
+	ECVF_Cheat);
+
+static FAutoConsoleCommandWithWorld GFlowRebuildCommand(
+	TEXT("paradise.nav.flow.Rebuild"),
+	TEXT("흐름장을 다시 계산합니다."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UFlowFieldSubsystem* FlowField = World ? World->GetSubsystem<UFlowFieldSubsystem>() : nullptr)
+		{
+			FlowField->RequestRebuild();
+		}
+	}));
+
+namespace FlowField
+{
+	/** @brief 8방향 이웃 오프셋 (앞 4개는 직선, 뒤 4개는 대각선) */
+	static const FIntPoint NeighborOffsets[8] =
+	{
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+		{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+	};
+
+	static bool HeapPredicate(const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key < B.Key;
+	}
+}
+
+#pragma region FFlowFieldData
+FVector FFlowFieldData::GetCellCenter(int32 X, int32 Y) const
+{
+	const int32 Index = ToIndex(X, Y);
+	const float Z = Height.IsValidIndex(Index) ? Height[Index] : Origin.Z;
+	return FVector(Origin.X + (X + 0.5f) * CellSize, Origin.Y + (Y + 0.5f) * CellSize, Z);
+}
+
+bool FFlowFieldData::ToCell(const FVector& Location, int32& OutX, int32& OutY) const
+{
+	if (!IsValid()) return false;
+
+	OutX = FMath::FloorToInt32((Location.X - Origin.X) / CellSize);
+	OutY = FMath::FloorToInt32((Location.Y - Origin.Y) / CellSize);
+	return IsInside(OutX, OutY);
+}
+#pragma endregion FFlowFieldData
+
+void UFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 동적 장애물 등으로 네비메시가 다시 생성되면 흐름장도 갱신
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UFlowFieldSubsystem::HandleNavigationGenerationFinished);
+	}
+}
+
+void UFlowFieldSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UFlowFieldSubsystem::HandleNavigationGenerationFinished);
+	}
+
+	Followers.Reset();
+	OpenHeap.Reset();
+	Active = FFlowFieldData();
+	Building = FFlowFieldData();
+	Phase = EBuildPhase::Idle;
+
+	Super::Deinitialize();
+}
+
+TStatId UFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	AdvanceBuild();
+	TickFollowers();
+
+#if ENABLE_DRAW_DEBUG
+	if (CVarFlowDebugDraw.GetValueOnGameThread() != 0)
+	{
+		DrawDebugField();
+	}
+#endif
+
+	SET_DWORD_STAT(STAT_Flow_Followers, Followers.Num());
+	SET_DWORD_STAT(STAT_Flow_Cells, Active.Num());
+}
+
+#pragma region 흐름장
+void UFlowFieldSubsystem::SetGoal(AHomeBase* InGoal)
+{
+	if (!IsValid(InGoal)) return;
+
+	Goal = InGoal;
+	RequestRebuild();
+}
+
+FVector UFlowFieldSubsystem::GetGoalLocation() const
+{
+	return Goal.IsValid() ? Goal->GetActorLocation() : FVector::ZeroVector;
+}
+
+bool UFlowFieldSubsystem::IsGoalLocation(const FVector& Location) const
+{
+	if (!Goal.IsValid()) return false;
+
+	const float MatchRadius = CVarFlowArrivalRadius.GetValueOnGameThread() + Active.CellSize;
+	return FVector::DistSquared2D(Location, Goal->GetActorLocation()) <= FMath::Square(MatchRadius);
+}
+
+bool UFlowFieldSubsystem::SampleDirection(const FVector& Location, FVector& OutDirection) const
+{
+	int32 X, Y;
+	if (!Active.ToCell(Location, X, Y)) return false;
+
+	const int32 Index = Active.ToIndex(X, Y);
+	if (Active.Cost[Index] == MAX_flt) return false;
+
+	const FVector2f& Dir = Active.Direction[Index];
+	if (Dir.IsNearlyZero())
+	{
+		// 목표 셀: 흐름장 대신 HomeBase로 직진
+		OutDirection = (GetGoalLocation() - Location).GetSafeNormal2D();
+		return !OutDirection.IsNearlyZero();
+	}
+
+	OutDirection = FVector(Dir.X, Dir.Y, 0.f);
+	return true;
+}
+
+void UFlowFieldSubsystem::WriteGoalKeys(UBlackboardComponent& Blackboard) const
+{
+	if (!Goal.IsValid()) return;
+
+	Blackboard.SetValueAsVector(BB_KEYS::TargetLocation, GetGoalLocation());
+	if (!Blackboard.GetValueAsObject(BB_KEYS::HomeBaseActor))
+	{
+		Blackboard.SetValueAsObject(BB_KEYS::HomeBaseActor, Goal.Get());
+	}
+}
+
+bool UFlowFieldSubsystem::BuildPathToGoal(const FVector& Start, TArray<FVector>& OutPoints) const
+{
+	if (CVarFlowEnable.GetValueOnGameThread() == 0) return false;
+
+	int32 X, Y;
+	if (!Active.ToCell(Start, X, Y) || Active.Cost[Active.ToIndex(X, Y)] == MAX_flt) return false;
+
+	OutPoints.Reset();
+	OutPoints.Add(Start);
+
+	// 비용이 계속 줄어드는 방향만 따라가므로 셀 수만큼 가면 반드시 목표 셀에 닿음
+	FIntPoint PrevStep = FIntPoint::ZeroValue;
+	for (int32 Steps = 0; Steps < Active.Num(); ++Steps)
+	{
+		const FVector2f& Dir = Active.Direction[Active.ToIndex(X, Y)];
+		if (Dir.IsNearlyZero()) break;
+
+		const FIntPoint Step(FMath::RoundToInt(Dir.X), FMath::RoundToInt(Dir.Y));
+
+		// 방향이 꺾이는 셀만 경유점으로
+		if (Steps > 0 && Step != PrevStep)
+		{
+			OutPoints.Add(Active.GetCellCenter(X, Y));
+		}
+		PrevStep = Step;
+		X += Step.X;
+		Y += Step.Y;
+	}
+
+	OutPoints.Add(GetGoalLocation());
+	return OutPoints.Num() > 1;
+}
+
+bool UFlowFieldSubsystem::FindFlowPath(const AAIController& Controller, const FAIMoveRequest& MoveRequest, const FPathFindingQuery& Query, FNavPathSharedPtr& OutPath)
+{
+	const UWorld* World = Controller.GetWorld();
+	const UFlowFieldSubsystem* FlowField = World ? World->GetSubsystem<UFlowFieldSubsystem>() : nullptr;
+	const APawn* Pawn = Controller.GetPawn();
+	if (!FlowField || !FlowField->IsReady() || !Pawn) return false;
+
+	const AActor* GoalActor = MoveRequest.IsMoveToActorRequest() ? MoveRequest.GetGoalActor() : nullptr;
+	const FVector GoalLocation = GoalActor ? GoalActor->GetActorLocation() : MoveRequest.GetGoalLocation();
+	if (!FlowField->IsGoalLocation(GoalLocation)) return false;
+
+	TArray<FVector> Points;
+	if (!FlowField->BuildPathToGoal(Pawn->GetActorLocation(), Points)) return false;
+
+	FNavPathSharedRef Path = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(Points);
+	Path->SetNavigationDataUsed(Query.NavData.Get());
+	Path->SetQuerier(&Controller);
+	OutPath = Path;
+
+	INC_DWORD_STAT(STAT_Flow_MovePaths);
+	return true;
+}
+
+bool UFlowFieldSubsystem::SampleHeight(const FVector& Location, float& OutHeight) const
+{
+	int32 X, Y;
+	if (!Active.ToCell(Location, X, Y)) return false;
+
+	const int32 Index = Active.ToIndex(X, Y);
+	if (!Active.Walkable[Index]) return false;
+
+	OutHeight = Active.Height[Index];
+	return true;
+}
+
+void UFlowFieldSubsystem::RequestRebuild()
+{
+	if (Phase != EBuildPhase::Idle)
+	{
+		// 진행 중인 계산은 이미 낡은 네비메시를 보고 있을 수 있으므로 끝나는 즉시 다시 시작
+		bRebuildQueued = true;
+		return;
+	}
+
+	BeginBuild();
+}
+
+void UFlowFieldSubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+	if (!Goal.IsValid()) return;
+
+	RequestRebuild();
+}
+
+void UFlowFieldSubsystem::BeginBuild()
+{
+	if (!Goal.IsValid()) return;
+
+	const float CellSize = FMath::Max(50.f, CVarFlowCellSize.GetValueOnGameThread());
+	const float Extent = FMath::Max(CellSize, CVarFlowExtent.GetValueOnGameThread());
+	const FVector GoalLocation = Goal->GetActorLocation();
+
+	Building = FFlowFieldData();
+	Building.CellSize = CellSize;
+	Building.SizeX = Building.SizeY = FMath::CeilToInt32(Extent * 2.f / CellSize);
+	Building.Origin = FVector(GoalLocation.X - Extent, GoalLocation.Y - Extent, GoalLocation.Z);
+
+	const int32 NumCells = Building.Num();
+	Building.Height.Init(GoalLocation.Z, NumCells);
+	Building.Walkable.Init(false, NumCells);
+	Building.Cost.Init(MAX_flt, NumCells);
+	Building.Direction.Init(FVector2f::ZeroVector, NumCells);
+
+	int32 GoalX, GoalY;
+	Building.ToCell(GoalLocation, GoalX, GoalY);
+	Building.GoalCell = FIntPoint(GoalX, GoalY);
+
+	OpenHeap.Reset();
+	BuildCursor = 0;
+	BuildStartTime = GetWorld()->GetTimeSeconds();
+	bRebuildQueued = false;
+	Phase = EBuildPhase::Project;
+
+	UE_LOG(LogTemp, Log, TEXT("🧭 [FlowField] 흐름장 계산 시작: %d x %d 셀 (%.0fcm)"), Building.SizeX, Building.SizeY, CellSize);
+}
+
+void UFlowFieldSubsystem::AdvanceBuild()
+{
+	if (Phase == EBuildPhase::Idle) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Flow_Build);
+
+	const int32 Budget = FMath::Max(1, CVarFlowCellsPerFrame.GetValueOnGameThread());
+
+	switch (Phase)
+	{
+	case EBuildPhase::Project:
+		StepProject(Budget);
+		break;
+	case EBuildPhase::Integrate:
+		StepIntegrate(Budget * 8);
+		break;
+	case EBuildPhase::Directions:
+		StepDirections(Budget * 8);
+		break;
+	default:
+		break;
+	}
+}
+
+void UFlowFieldSubsystem::StepProject(int32 Budget)
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		Phase = EBuildPhase::Idle;
+		return;
+	}
+
+	const int32 NumCells = Building.Num();
+	const float HalfCell = Building.CellSize * 0.5f;
+	const FVector QueryExtent(HalfCell, HalfCell, 1000.f);
+
+	const int32 End = FMath::Min(NumCells, BuildCursor + Budget);
+	for (; BuildCursor < End; ++BuildCursor)
+	{
+		const int32 X = BuildCursor % Building.SizeX;
+		const int32 Y = BuildCursor / Building.SizeX;
+
+		FNavLocation Projected;
+		if (NavSys->ProjectPointToNavigation(Building.GetCellCenter(X, Y), Projected, QueryExtent))
+		{
+			Building.Walkable[BuildCursor] = true;
+			Building.Height[BuildCursor] = Projected.Location.Z;
+		}
+	}
+
+	if (BuildCursor < NumCells) return;
+
+	// 목표 셀은 HomeBase가 네비메시를 깎아 먹었더라도 항상 도달 가능으로 취급
+	const int32 GoalIndex = Building.ToIndex(Building.GoalCell.X, Building.GoalCell.Y);
+	Building.Walkable[GoalIndex] = true;
+	Building.Cost[GoalIndex] = 0.f;
+	OpenHeap.HeapPush(TPair<float, int32>(0.f, GoalIndex), FlowField::HeapPredicate);
+
+	Phase = EBuildPhase::Integrate;
+}
+
+void UFlowFieldSubsystem::StepIntegrate(int32 Budget)
+{
+	static constexpr float DiagonalCost = UE_SQRT_2;
+
+	for (int32 Count = 0; Count < Budget && OpenHeap.Num() > 0; ++Count)
+	{
+		TPair<float, int32> Current;
+		OpenHeap.HeapPop(Current, FlowField::HeapPredicate, EAllowShrinking::No);
+
+		// 더 짧은 경로로 이미 갱신된 항목
+		if (Current.Key > Building.Cost[Current.Value]) continue;
+
+		const int32 X = Current.Value % Building.SizeX;
+		const int32 Y = Current.Value / Building.SizeX;
+
+		for (int32 Dir = 0; Dir < 8; ++Dir)
+		{
+			const int32 NX = X + FlowField::NeighborOffsets[Dir].X;
+			const int32 NY = Y + FlowField::NeighborOffsets[Dir].Y;
+			if (!CanStep(Building, X, Y, NX, NY)) continue;
+
+			const int32 NeighborIndex = Building.ToIndex(NX, NY);
+			const float NewCost = Current.Key + (Dir < 4 ? 1.f : DiagonalCost);
+			if (NewCost < Building.Cost[NeighborIndex])
+			{
+				Building.Cost[NeighborIndex] = NewCost;
+				OpenHeap.HeapPush(TPair<float, int32>(NewCost, NeighborIndex), FlowField::HeapPredicate);
+			}
+		}
+	}
+
+	if (OpenHeap.Num() > 0) return;
+
+	BuildCursor = 0;
+	Phase = EBuildPhase::Directions;
+}
+
+void UFlowFieldSubsystem::StepDirections(int32 Budget)
+{
+	const int32 NumCells = Building.Num();
+	const int32 GoalIndex = Building.ToIndex(Building.GoalCell.X, Building.GoalCell.Y);
+
+	const int32 End = FMath::Min(NumCells, BuildCursor + Budget);
+	for (; BuildCursor < End; ++BuildCursor)
+	{
+		if (BuildCursor == GoalIndex || Building.Cost[BuildCursor] == MAX_flt) continue;
+
+		const int32 X = BuildCursor % Building.SizeX;
+		const int32 Y = BuildCursor / Building.SizeX;
+
+		// 비용이 가장 낮은 이웃 쪽으로
+		float BestCost = Building.Cost[BuildCursor];
+		FIntPoint BestOffset = FIntPoint::ZeroValue;
+		for (const FIntPoint& Offset : FlowField::NeighborOffsets)
+		{
+			const int32 NX = X + Offset.X;
+			const int32 NY = Y + Offset.Y;
+			if (!CanStep(Building, X, Y, NX, NY)) continue;
+
+			const float NeighborCost = Building.Cost[Building.ToIndex(NX, NY)];
+			if (NeighborCost < BestCost)
+			{
+				BestCost = NeighborCost;
+				BestOffset = Offset;
+			}
+		}
+
+		Building.Direction[BuildCursor] = FVector2f(BestOffset.X, BestOffset.Y).GetSafeNormal();
+	}
+
+	if (BuildCursor < NumCells) return;
+
+	// 완성된 흐름장으로 교체 (계산 중에는 이전 흐름장을 계속 사용)
+	Swap(Active, Building);
+	Building = FFlowFieldData();
+	OpenHeap.Empty();
+	Phase = EBuildPhase::Idle;
+
+	SET_FLOAT_STAT(STAT_Flow_LastBuildSeconds, GetWorld()->GetTimeSeconds() - BuildStartTime);
+	UE_LOG(LogTemp, Log, TEXT("🧭 [FlowField] 흐름장 계산 완료 (%d 셀)"), Active.Num());
+
+	if (bRebuildQueued)
+	{
+		BeginBuild();
+	}
+}
+
+bool UFlowFieldSubsystem::CanStep(const FFlowFieldData& Field, int32 FromX, int32 FromY, int32 ToX, int32 ToY) const
+{
+	if (!Field.IsInside(ToX, ToY)) return false;
+
+	const int32 ToIndex = Field.ToIndex(ToX, ToY);
+	if (!Field.Walkable[ToIndex]) return false;
+
+	const float MaxHeightStep = CVarFlowMaxHeightStep.GetValueOnGameThread();
+	if (FMath::Abs(Field.Height[ToIndex] - Field.Height[Field.ToIndex(FromX, FromY)]) > MaxHeightStep) return false;
+
+	// 대각선 이동은 양옆 셀이 모두 열려 있어야 함 (벽 모서리 관통 방지)
+	if (FromX != ToX && FromY != ToY)
+	{
+		if (!Field.Walkable[Field.ToIndex(ToX, FromY)] || !Field.Walkable[Field.ToIndex(FromX, ToY)]) return false;
+	}
+
+	return true;
+}
+#pragma endregion 흐름장
+
+#pragma region 흐름 추종
+bool UFlowFieldSubsystem::StartFollowing(ABaseUnit* Unit)
+{
+	if (CVarFlowEnable.GetValueOnGameThread() == 0 || !IsReady() || !IsValid(Unit)) return false;
+
+	FVector Direction;
+	if (!SampleDirection(Unit->GetActorLocation(), Direction)) return false;
+
+	if (!Followers.Contains(Unit))
+	{
+		// 이전 경로 추종과 이동 입력이 섞이지 않도록 정지
+		if (AAIController* AIController = Cast<AAIController>(Unit->GetController()))
+		{
+			AIController->StopMovement();
+		}
+		Followers.Add(Unit, Unit);
+	}
+	return true;
+}
+
+void UFlowFieldSubsystem::StopFollowing(ABaseUnit* Unit)
+{
+	Followers.Remove(Unit);
+}
+
+void UFlowFieldSubsystem::TickFollowers()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Flow_Follow);
+
+	if (Followers.Num() == 0) return;
+
+	const bool bEnabled = CVarFlowEnable.GetValueOnGameThread() != 0 && IsReady() && Goal.IsValid();
+	const FVector GoalLocation = GetGoalLocation();
+	const float ArrivalRadiusSq = FMath::Square(CVarFlowArrivalRadius.GetValueOnGameThread());
+
+	for (auto It = Followers.CreateIterator(); It; ++It)
+	{
+		ABaseUnit* Unit = It.Value().Get();
+		if (!Unit || Unit->bIsDead || Unit->IsHidden())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		AAIController* AIController = Cast<AAIController>(Unit->GetController());
+		if (!AIController)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 적 유닛과 교전 시작 → BT와 일반 경로 탐색에 맡김
+		const UBlackboardComponent* BB = AIController->GetBlackboardComponent();
+		if (BB && BB->GetValueAsObject(BB_KEYS::TargetActor))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 휴면/플레이어 조작 중에는 입력만 멈춤
+		const UBrainComponent* Brain = AIController->GetBrainComponent();
+		if (Brain && Brain->IsPaused()) continue;
+
+		const FVector Location = Unit->GetActorLocation();
+		if (FVector::DistSquared2D(Location, GoalLocation) <= ArrivalRadiusSq)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		FVector Direction;
+		if (!bEnabled || !SampleDirection(Location, Direction))
+		{
+			// 흐름장 밖/도달 불가 셀 → 일반 경로 탐색
+			AIController->MoveToLocation(GoalLocation);
+			INC_DWORD_STAT(STAT_Flow_Fallbacks);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Unit->AddMovementInput(Direction);
+	}
+}
+#pragma endregion 흐름 추종
+
+void UFlowFieldSubsystem::DrawDebugField() const
+{
+#if ENABLE_DRAW_DEBUG
+	const UWorld* World = GetWorld();
+	const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	const APawn* ViewPawn = PC ? PC->GetPawn() : nullptr;
+	if (!ViewPawn || !Active.IsValid()) return;
+
+	static constexpr int32 DrawRadiusCells = 12;
+
+	int32 CenterX, CenterY;
+	if (!Active.ToCell(ViewPawn->GetActorLocation(), CenterX, CenterY)) return;
+
+	for (int32 Y = CenterY - DrawRadiusCells; Y <= CenterY + DrawRadiusCells; ++Y)
+	{
+		for (int32 X = CenterX - DrawRadiusCells; X <= CenterX + DrawRadiusCells; ++X)
+		{
+			if (!Active.IsInside(X, Y)) continue;
+
+			const int32 Index = Active.ToIndex(X, Y);
+			const FVector Center = Active.GetCellCenter(X, Y) + FVector(0.f, 0.f, 20.f);
+			if (Active.Cost[Index] == MAX_flt)
+			{
+				DrawDebugPoint(World, Center, 6.f, FColor::Red);
+				continue;
+			}
+
+			const FVector2f& Dir = Active.Direction[Index];
+			const FVector End = Center + FVector(Dir.X, Dir.Y, 0.f) * Active.CellSize * 0.4f;
+			DrawDebugDirectionalArrow(World, Center, End, 30.f, FColor::Cyan);
+		}
+	}
+#endif
+}
@@ -3,76 +3,871 @@
 
 #include "Framework/System/ObjectPoolSubsystem.h"
 #include "Interfaces/ObjectPoolInterface.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+/**
+ * 재사용/반납마다 찍히던 로그는 웨이브 스파이크 때 그 자체로 프레임을 잡아먹으므로 기본적으로 컴파일에서 제외합니다.
+ * 디버깅이 필요하면 1로 정의하세요.
+ */
+#ifndef PARADISE_POOL_VERBOSE_LOG
+#define PARADISE_POOL_VERBOSE_LOG 0
+#endif
+
+#if PARADISE_POOL_VERBOSE_LOG
+#define POOL_VERBOSE_LOG(Format, ...) UE_LOG(LogTemp, Warning, Format, ##__VA_ARGS__)
+#else
+#define POOL_VERBOSE_LOG(Format, ...)
+#endif
+
+DECLARE_STATS_GROUP(TEXT("ParadisePool"), STATGROUP_ParadisePool, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("SpawnPooledActor"), STAT_Pool_SpawnPooledActor, STATGROUP_ParadisePool);
+DECLARE_CYCLE_STAT(TEXT("ReturnToPool"), STAT_Pool_ReturnToPool, STATGROUP_ParadisePool);
+DECLARE_CYCLE_STAT(TEXT("SpawnActor (Miss)"), STAT_Pool_MissSpawn, STATGROUP_ParadisePool);
+DECLARE_CYCLE_STAT(TEXT("Tick"), STAT_Pool_Tick, STATGROUP_ParadisePool);
+DECLARE_CYCLE_STAT(TEXT("Prewarm"), STAT_Pool_Prewarm, STATGROUP_ParadisePool);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits / Frame"), STAT_Pool_Hits, STATGROUP_ParadisePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Misses / Frame"), STAT_Pool_Misses, STATGROUP_ParadisePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Invalid Discards / Frame"), STAT_Pool_InvalidDiscards, STATGROUP_ParadisePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Rejected Returns / Frame"), STAT_Pool_RejectedReturns, STATGROUP_ParadisePool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors"), STAT_Pool_NumPooled, STATGROUP_ParadisePool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Actors"), STAT_Pool_NumActive, STATGROUP_ParadisePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Prewarm Spawns / Frame"), STAT_Pool_PrewarmSpawns, STATGROUP_ParadisePool);
+
+static TAutoConsoleVariable<float> CVarPoolPrewarmBudgetMs(
+	TEXT("paradise.pool.PrewarmBudgetMs"),
+	2.0f,
+	TEXT("풀 예열에 프레임당 사용할 최대 시간(ms). 최소 1개는 항상 생성합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPoolDefaultCapacity(
+	TEXT("paradise.pool.DefaultCapacity"),
+	64,
+	TEXT("클래스별 풀 기본 최대 보유량. 가득 찬 상태의 반납은 파괴로 처리합니다. (0 = 무제한)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPoolIdleTrimSeconds(
+	TEXT("paradise.pool.IdleTrimSeconds"),
+	60.0f,
+	TEXT("이 시간(초) 이상 풀에서 대기한 액터는 파괴합니다. 예열 요청량(MinRetain)은 남깁니다. (0 = 끄기)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPoolMemoryBudgetMB(
+	TEXT("paradise.pool.MemoryBudgetMB"),
+	0.0f,
+	TEXT("대기 액터 전체의 추정 메모리 예산(MB). 넘으면 가장 오래 쓰지 않은 클래스부터 비웁니다. (0 = 끄기)"),
+	ECVF_Default);
+
+/** @brief 유휴 트리밍/메모리 예산 검사 주기 (초) */
+static constexpr double PoolTrimCheckInterval = 2.0;
+
+namespace ObjectPoolStats
+{
+	static void SetPooled(FObjectPoolClassStats& Stats, int32 NewNum)
+	{
+		INC_DWORD_STAT_BY(STAT_Pool_NumPooled, FMath::Max(NewNum - Stats.NumPooled, 0));
+		DEC_DWORD_STAT_BY(STAT_Pool_NumPooled, FMath::Max(Stats.NumPooled - NewNum, 0));
+		Stats.NumPooled = NewNum;
+		Stats.PeakPooled = FMath::Max(Stats.PeakPooled, NewNum);
+	}
+
+	static void AddActive(FObjectPoolClassStats& Stats, int32 Delta)
+	{
+		const int32 NewNum = FMath::Max(Stats.NumActive + Delta, 0);
+		INC_DWORD_STAT_BY(STAT_Pool_NumActive, FMath::Max(NewNum - Stats.NumActive, 0));
+		DEC_DWORD_STAT_BY(STAT_Pool_NumActive, FMath::Max(Stats.NumActive - NewNum, 0));
+		Stats.NumActive = NewNum;
+		Stats.PeakActive = FMath::Max(Stats.PeakActive, NewNum);
+	}
+}
+
+namespace ObjectPoolDispatch
+{
+	/**
+	 * 훅 호출 중 다른 풀 요청으로 Slots/Pools 배열이 재할당될 수 있으므로
+	 * 참조 대신 필요한 값만 복사해서 넘겨받습니다.
+	 */
+	static void Activate(EPoolDispatchMode Mode, AActor* Actor, IObjectPoolInterface* NativeInterface)
+	{
+		if (Mode == EPoolDispatchMode::Native && NativeInterface)
+		{
+			NativeInterface->OnPoolActivate_Implementation();
+		}
+		else if (Mode != EPoolDispatchMode::None)
+		{
+			IObjectPoolInterface::Execute_OnPoolActivate(Actor);
+		}
+	}
+
+	static void Deactivate(EPoolDispatchMode Mode, AActor* Actor, IObjectPoolInterface* NativeInterface)
+	{
+		if (Mode == EPoolDispatchMode::Native && NativeInterface)
+		{
+			NativeInterface->OnPoolDeactivate_Implementation();
+		}
+		else if (Mode != EPoolDispatchMode::None)
+		{
+			IObjectPoolInterface::Execute_OnPoolDeactivate(Actor);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorld GPoolDumpCommand(
+	TEXT("paradise.pool.dump"),
+	TEXT("현재 월드의 오브젝트 풀 통계를 클래스별로 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (const UObjectPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr)
+		{
+			PoolSubsystem->DumpPoolStats();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GPoolBenchCommand(
+	TEXT("paradise.pool.bench"),
+	TEXT("스폰/반납 1회 비용을 이전 방식과 핸들 방식으로 비교합니다. 게임 진행 중에는 실행되지 않습니다(pause 후 사용). 사용법: paradise.pool.bench [클래스 경로] [초당 스폰 수=1000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UObjectPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr;
+		if (!PoolSubsystem) return;
+
+		UClass* BenchClass = nullptr;
+		if (Args.Num() > 0)
+		{
+			BenchClass = LoadObject<UClass>(nullptr, *Args[0]);
+		}
+		else
+		{
+			// 클래스를 지정하지 않으면 현재 가장 많이 쓰이는 풀로 측정
+			int32 BestCount = -1;
+			for (const FObjectPoolClassStats& Stats : PoolSubsystem->GetAllPoolStats())
+			{
+				if (Stats.NumPooled + Stats.NumActive > BestCount)
+				{
+					BestCount = Stats.NumPooled + Stats.NumActive;
+					BenchClass = Stats.PoolClass;
+				}
+			}
+		}
+
+		const int32 SpawnsPerSecond = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000;
+		PoolSubsystem->RunSpawnBenchmark(BenchClass, FMath::Max(SpawnsPerSecond, 1));
+	}));
+
+void UObjectPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddUObject(this, &UObjectPoolSubsystem::HandleLowMemory);
+}
+
+void UObjectPoolSubsystem::Deinitialize()
+{
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+
+	// 누적(Accumulator) 스탯은 프레임마다 초기화되지 않으므로 월드가 내려갈 때 직접 빼줍니다.
+	for (FObjectPoolQueue& PoolQueue : Pools)
+	{
+		ObjectPoolStats::SetPooled(PoolQueue.Stats, 0);
+		ObjectPoolStats::AddActive(PoolQueue.Stats, -PoolQueue.Stats.NumActive);
+	}
+
+	PendingPrewarms.Reset();
+
+	Super::Deinitialize();
+}
+
+void UObjectPoolSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Tick);
+
+	Super::Tick(DeltaTime);
+
+	if (PendingPrewarms.Num() > 0)
+	{
+		ProcessPrewarmQueue();
+	}
+
+	if (bPendingLowMemoryTrim.exchange(false))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ [ObjectPool] 저메모리 알림 - 대기 액터 정리 (%.1f MB)"),
+			GetEstimatedPooledBytes() / (1024.0 * 1024.0));
+		TrimPools(true);
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now >= NextTrimCheckTime)
+	{
+		NextTrimCheckTime = Now + PoolTrimCheckInterval;
+		TrimIdleActors(Now);
+		EnforceMemoryBudget();
+	}
+}
+
+TStatId UObjectPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UObjectPoolSubsystem, STATGROUP_Tickables);
+}
+
+FPoolClassHandle UObjectPoolSubsystem::ResolvePoolHandle(UClass* Class)
+{
+	FPoolClassHandle Handle;
+	if (!Class) return Handle;
+
+	if (const int32* Found = PoolIndexMap.Find(Class))
+	{
+		Handle.Index = *Found;
+		return Handle;
+	}
+
+	Handle.Index = Pools.AddDefaulted();
+	PoolIndexMap.Add(Class, Handle.Index);
+
+	FObjectPoolQueue& PoolQueue = Pools[Handle.Index];
+	PoolQueue.Stats.PoolClass = Class;
+
+	// 인터페이스 구현 여부와 호출 방식은 클래스당 여기서 한 번만 판별합니다.
+	if (Class->ImplementsInterface(UObjectPoolInterface::StaticClass()))
+	{
+		const bool bNativeImplementation = Cast<IObjectPoolInterface>(Class->GetDefaultObject()) != nullptr;
+		const bool bScriptOverride =
+			Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IObjectPoolInterface, OnPoolActivate)) ||
+			Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(IObjectPoolInterface, OnPoolDeactivate));
+
+		PoolQueue.DispatchMode = (bNativeImplementation && !bScriptOverride) ? EPoolDispatchMode::Native : EPoolDispatchMode::Reflection;
+	}
+
+	return Handle;
+}
+
+FPoolClassHandle UObjectPoolSubsystem::ResolveBenchmarkPoolHandle(UClass* Class)
+{
+	FPoolClassHandle Handle;
+	if (const int32* Found = BenchmarkPoolIndexMap.Find(Class))
+	{
+		Handle.Index = *Found;
+		return Handle;
+	}
+
+	// 호출 방식 판별은 게임 풀과 같게 맞춤 (PoolIndexMap에는 넣지 않으므로 다른 코드가 꺼내 쓸 수 없음)
+	const EPoolDispatchMode DispatchMode = Pools[ResolvePoolHandle(Class).Index].DispatchMode;
+
+	Handle.Index = Pools.AddDefaulted();
+	BenchmarkPoolIndexMap.Add(Class, Handle.Index);
+
+	FObjectPoolQueue& PoolQueue = Pools[Handle.Index];
+	PoolQueue.Stats.PoolClass = Class;
+	PoolQueue.DispatchMode = DispatchMode;
+	PoolQueue.bBenchmarkOnly = true;
+
+	return Handle;
+}
 
 AActor* UObjectPoolSubsystem::SpawnPooledActor(UClass* Class, FVector location,
 	FRotator rotation, AActor* Owner, APawn* Instigator)
 {
-	if (!Class) return nullptr;
+	return SpawnFromPool(ResolvePoolHandle(Class), location, rotation, Owner, Instigator);
+}
 
-	FObjectPoolQueue& PoolQueue = PoolMap.FindOrAdd(Class);
+AActor* UObjectPoolSubsystem::SpawnFromPool(FPoolClassHandle PoolHandle, const FVector& Location,
+	const FRotator& Rotation, AActor* Owner, APawn* Instigator, FPooledActorHandle* OutHandle)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_SpawnPooledActor);
 
-	AActor* PooledActor = nullptr;
+	if (!Pools.IsValidIndex(PoolHandle.Index)) return nullptr;
+
+	FObjectPoolQueue& PoolQueue = Pools[PoolHandle.Index];
+	FObjectPoolClassStats& Stats = PoolQueue.Stats;
+	PoolQueue.LastUsedTime = GetWorld()->GetTimeSeconds();
+
+	int32 SlotIndex = INDEX_NONE;
 
 	//풀에 남는 게 있는지 확인 (유효하지 않은 건 버림)
-	while (PoolQueue.Pool.Num() > 0)
+	while (PoolQueue.NumPooled() > 0)
 	{
-		AActor* Candidate = PoolQueue.Pool.Pop();
-		if (IsValid(Candidate))
+		const int32 Candidate = PoolQueue.Pop();
+		if (IsValid(Slots[Candidate].Actor))
 		{
-			PooledActor = Candidate;
-			UE_LOG(LogTemp, Warning, TEXT("♻️ [ObjectPool] 재사용 성공 (Reuse): %s (남은 개수: %d)"),
-				*PooledActor->GetName(), PoolQueue.Pool.Num());
+			SlotIndex = Candidate;
+			POOL_VERBOSE_LOG(TEXT("♻️ [ObjectPool] 재사용 성공 (Reuse): %s (남은 개수: %d)"),
+				*Slots[SlotIndex].Actor->GetName(), PoolQueue.NumPooled());
 			break;
 		}
+
+		++Stats.InvalidDiscardCount;
+		INC_DWORD_STAT(STAT_Pool_InvalidDiscards);
+		FreeSlot(Candidate);
 	}
+	ObjectPoolStats::SetPooled(Stats, PoolQueue.NumPooled());
+
+	AActor* PooledActor = nullptr;
 
 	//풀에 없으면 새로 생성
-	if (!PooledActor)
+	if (SlotIndex == INDEX_NONE)
 	{
 		FActorSpawnParameters Params;
 		Params.Owner = Owner;
 		Params.Instigator = Instigator;
 		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-		PooledActor = GetWorld()->SpawnActor<AActor>(Class, location, rotation, Params);
 
-		if (PooledActor)
+		UClass* Class = Stats.PoolClass;
+		const uint64 SpawnStartCycles = FPlatformTime::Cycles64();
 		{
-			UE_LOG(LogTemp, Warning, TEXT("✨ [ObjectPool] 신규 생성 (New Spawn): %s"),
-				*PooledActor->GetName());
+			SCOPE_CYCLE_COUNTER(STAT_Pool_MissSpawn);
+			PooledActor = GetWorld()->SpawnActor<AActor>(Class, Location, Rotation, Params);
 		}
+		const float SpawnTimeMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SpawnStartCycles));
+
+		// SpawnActor 도중 BeginPlay 등에서 다른 풀이 생성되면 Pools가 재할당될 수 있으므로 다시 참조합니다.
+		FObjectPoolClassStats& MissStats = Pools[PoolHandle.Index].Stats;
+		++MissStats.MissCount;
+		MissStats.TotalMissSpawnTimeMs += SpawnTimeMs;
+		MissStats.MaxMissSpawnTimeMs = FMath::Max(MissStats.MaxMissSpawnTimeMs, SpawnTimeMs);
+		INC_DWORD_STAT(STAT_Pool_Misses);
+
+		if (!PooledActor) return nullptr;
+
+		POOL_VERBOSE_LOG(TEXT("✨ [ObjectPool] 신규 생성 (New Spawn): %s (%.3f ms)"),
+			*PooledActor->GetName(), SpawnTimeMs);
+
+		// 인터페이스 미구현 클래스는 풀이 관리하지 않습니다. (반납 시 파괴)
+		if (Pools[PoolHandle.Index].DispatchMode == EPoolDispatchMode::None)
+		{
+			return PooledActor;
+		}
+
+		SlotIndex = AllocateSlot(PooledActor, PoolHandle.Index);
 	}
 	else
 	{
+		++Stats.HitCount;
+		INC_DWORD_STAT(STAT_Pool_Hits);
+
 		// 풀에서 꺼냈으면 위치/회전 강제 지정
-		PooledActor->SetActorLocationAndRotation(location, rotation);
+		PooledActor = Slots[SlotIndex].Actor;
+		PooledActor->SetActorLocationAndRotation(Location, Rotation);
 	}
 
-	//활성화 처리 (인터페이스 호출)
-	if (PooledActor && PooledActor->Implements<UObjectPoolInterface>())
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	Slot.bInPool = false;
+	++Slot.Generation;
+
+	if (OutHandle)
 	{
-		//(초기화)
-		IObjectPoolInterface::Execute_OnPoolActivate(PooledActor);
+		OutHandle->SlotIndex = SlotIndex;
+		OutHandle->Generation = Slot.Generation;
 	}
+
+	FObjectPoolQueue& ActiveQueue = Pools[PoolHandle.Index];
+	ObjectPoolStats::AddActive(ActiveQueue.Stats, 1);
+
+	//활성화 처리 (C++ 구현은 가상 함수 직접 호출, BP 구현은 리플렉션)
+	ObjectPoolDispatch::Activate(ActiveQueue.DispatchMode, PooledActor, Slot.NativeInterface);
 	return PooledActor;
 }
 
+bool UObjectPoolSubsystem::ReleaseToPool(const FPooledActorHandle& Handle)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ReturnToPool);
+
+	if (!Slots.IsValidIndex(Handle.SlotIndex)) return false;
+
+	const FPooledActorSlot& Slot = Slots[Handle.SlotIndex];
+	if (Slot.Generation != Handle.Generation || Slot.bInPool || !IsValid(Slot.Actor))
+	{
+		// 이미 반납되었거나 다른 용도로 재사용된 액터에 대한 지연 반납
+		if (Pools.IsValidIndex(Slot.PoolIndex))
+		{
+			++Pools[Slot.PoolIndex].Stats.RejectedReturnCount;
+		}
+		INC_DWORD_STAT(STAT_Pool_RejectedReturns);
+		return false;
+	}
+
+	ReturnSlotToPool(Handle.SlotIndex);
+	return true;
+}
+
 void UObjectPoolSubsystem::ReturnToPool(AActor* InActor)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Pool_ReturnToPool);
+
 	if (IsValid(InActor)) {
-		if (InActor->Implements<UObjectPoolInterface>()) {
-			IObjectPoolInterface::Execute_OnPoolDeactivate(InActor);
+		if (const int32* FoundSlot = ActorSlotMap.Find(InActor))
+		{
+			if (Slots[*FoundSlot].bInPool)
+			{
+				// 같은 액터를 두 번 반납 (사망 처리 중복 등)
+				++Pools[Slots[*FoundSlot].PoolIndex].Stats.RejectedReturnCount;
+				INC_DWORD_STAT(STAT_Pool_RejectedReturns);
+				return;
+			}
+
+			ReturnSlotToPool(*FoundSlot);
+			return;
 		}
-		else {
+
+		// 풀 밖에서 생성된 액터(레벨 배치 등)도 기존처럼 받아줍니다.
+		const FPoolClassHandle PoolHandle = ResolvePoolHandle(InActor->GetClass());
+		if (Pools[PoolHandle.Index].DispatchMode == EPoolDispatchMode::None) {
 			InActor->Destroy();
 			UE_LOG(LogTemp, Error, TEXT("IObjectPoolInterface : 인터페이스 구현안되있음"));
 			return;
 		}
 
-		FObjectPoolQueue& poolQueue = PoolMap.FindOrAdd(InActor->GetClass());
-		poolQueue.Pool.Push(InActor);
+		const int32 SlotIndex = AllocateSlot(InActor, PoolHandle.Index);
+		ObjectPoolStats::AddActive(Pools[PoolHandle.Index].Stats, 1);
+		ReturnSlotToPool(SlotIndex);
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("📥 [ObjectPool] 반납 완료 (Return): %s (현재 보유량: %d)"),
-			*InActor->GetName(), poolQueue.Pool.Num());
+}
+
+FPooledActorHandle UObjectPoolSubsystem::FindActorHandle(const AActor* InActor) const
+{
+	FPooledActorHandle Handle;
+	if (const int32* FoundSlot = ActorSlotMap.Find(InActor))
+	{
+		Handle.SlotIndex = *FoundSlot;
+		Handle.Generation = Slots[*FoundSlot].Generation;
 	}
+	return Handle;
+}
+
+AActor* UObjectPoolSubsystem::ResolveActorHandle(const FPooledActorHandle& Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.SlotIndex)) return nullptr;
+
+	const FPooledActorSlot& Slot = Slots[Handle.SlotIndex];
+	return (Slot.Generation == Handle.Generation && !Slot.bInPool) ? Slot.Actor.Get() : nullptr;
+}
+
+int32 UObjectPoolSubsystem::AllocateSlot(AActor* InActor, int32 PoolIndex)
+{
+	const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	Slot.Actor = InActor;
+	Slot.PoolIndex = PoolIndex;
+	Slot.bInPool = false;
+	Slot.NativeInterface = Pools[PoolIndex].DispatchMode == EPoolDispatchMode::Native ? Cast<IObjectPoolInterface>(InActor) : nullptr;
+
+	ActorSlotMap.Add(InActor, SlotIndex);
+	return SlotIndex;
+}
 
-}
\ No newline at end of file
+void UObjectPoolSubsystem::FreeSlot(int32 SlotIndex)
+{
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	ActorSlotMap.Remove(Slot.Actor.Get());
+
+	// 세대를 올려 이 슬롯을 가리키던 기존 핸들을 모두 무효화합니다.
+	++Slot.Generation;
+	Slot.Actor = nullptr;
+	Slot.NativeInterface = nullptr;
+	Slot.PoolIndex = INDEX_NONE;
+	Slot.bInPool = false;
+
+	FreeSlots.Add(SlotIndex);
+}
+
+void UObjectPoolSubsystem::ReturnSlotToPool(int32 SlotIndex)
+{
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	AActor* Actor = Slot.Actor;
+	IObjectPoolInterface* NativeInterface = Slot.NativeInterface;
+	const int32 PoolIndex = Slot.PoolIndex;
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// 비활성화 훅 안에서 다시 반납이 들어와도 무시되도록 먼저 표시합니다.
+	Slot.bInPool = true;
+
+	{
+		FObjectPoolQueue& PoolQueue = Pools[PoolIndex];
+		PoolQueue.LastUsedTime = Now;
+		ObjectPoolStats::AddActive(PoolQueue.Stats, -1);
+		ObjectPoolDispatch::Deactivate(PoolQueue.DispatchMode, Actor, NativeInterface);
+	}
+
+	FObjectPoolQueue& PoolQueue = Pools[PoolIndex];
+
+	// 용량이 가득 찼으면 보관하지 않고 파괴 (웨이브 피크 이후 상주 메모리가 계속 늘어나는 것을 방지)
+	const int32 Capacity = GetEffectiveCapacity(PoolQueue);
+	if (Capacity > 0 && PoolQueue.NumPooled() >= Capacity)
+	{
+		++PoolQueue.Stats.TrimmedCount;
+		FreeSlot(SlotIndex);
+		Actor->Destroy();
+		return;
+	}
+
+	// 클래스당 1회만 메모리 측정 (Exclusive: 공유 에셋 제외, 인스턴스 고유 메모리만)
+	if (PoolQueue.Stats.EstimatedBytesPerActor <= 0)
+	{
+		PoolQueue.Stats.EstimatedBytesPerActor = static_cast<int64>(Actor->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+	}
+
+	PoolQueue.Push(SlotIndex, Now);
+	ObjectPoolStats::SetPooled(PoolQueue.Stats, PoolQueue.NumPooled());
+
+	POOL_VERBOSE_LOG(TEXT("📥 [ObjectPool] 반납 완료 (Return): %s (현재 보유량: %d)"),
+		*Actor->GetName(), PoolQueue.NumPooled());
+}
+
+#pragma region 예열 (Prewarm)
+void UObjectPoolSubsystem::RequestPrewarm(const TArray<FPoolPrewarmRequest>& Requests)
+{
+	// 새 배치 시작 시 진행률 초기화
+	if (PendingPrewarms.Num() == 0)
+	{
+		PrewarmBatchTotal = 0;
+		PrewarmBatchDone = 0;
+	}
+
+	for (const FPoolPrewarmRequest& Request : Requests)
+	{
+		if (!Request.ActorClass || Request.Count <= 0) continue;
+
+		const FPoolClassHandle PoolHandle = ResolvePoolHandle(Request.ActorClass);
+		FObjectPoolQueue& PoolQueue = Pools[PoolHandle.Index];
+		if (PoolQueue.DispatchMode == EPoolDispatchMode::None)
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ [ObjectPool] 예열 불가 - 인터페이스 미구현: %s"), *Request.ActorClass->GetName());
+			continue;
+		}
+
+		PendingPrewarms.Add(Request);
+		PrewarmBatchTotal += Request.Count;
+
+		// 예열한 만큼은 유휴 트리밍 대상에서 제외 (웨이브 사이 공백에 다시 Cold Pool이 되지 않도록)
+		PoolQueue.MinRetain += Request.Count;
+	}
+}
+
+float UObjectPoolSubsystem::GetPrewarmProgress() const
+{
+	return PrewarmBatchTotal > 0 ? static_cast<float>(PrewarmBatchDone) / PrewarmBatchTotal : 1.f;
+}
+
+void UObjectPoolSubsystem::ProcessPrewarmQueue()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Pool_Prewarm);
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const double BudgetSeconds = FMath::Max(CVarPoolPrewarmBudgetMs.GetValueOnGameThread(), 0.f) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// 예산을 넘기더라도 프레임당 최소 1개는 생성해 진행이 멈추지 않도록 합니다.
+	do
+	{
+		const FPoolPrewarmRequest Request = PendingPrewarms[0];
+
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AActor* NewActor = World->SpawnActor<AActor>(Request.ActorClass, Request.SpawnLocation, FRotator::ZeroRotator, Params);
+
+		if (NewActor)
+		{
+			const FPoolClassHandle PoolHandle = ResolvePoolHandle(Request.ActorClass);
+			const int32 SlotIndex = AllocateSlot(NewActor, PoolHandle.Index);
+			Slots[SlotIndex].bInPool = true;
+			ObjectPoolDispatch::Deactivate(Pools[PoolHandle.Index].DispatchMode, NewActor, Slots[SlotIndex].NativeInterface);
+
+			FObjectPoolQueue& PoolQueue = Pools[PoolHandle.Index];
+			if (PoolQueue.Stats.EstimatedBytesPerActor <= 0)
+			{
+				PoolQueue.Stats.EstimatedBytesPerActor = static_cast<int64>(NewActor->GetResourceSizeBytes(EResourceSizeMode::Exclusive));
+			}
+			PoolQueue.Push(SlotIndex, World->GetTimeSeconds());
+			ObjectPoolStats::SetPooled(PoolQueue.Stats, PoolQueue.NumPooled());
+			INC_DWORD_STAT(STAT_Pool_PrewarmSpawns);
+		}
+
+		++PrewarmBatchDone;
+		if (--PendingPrewarms[0].Count <= 0)
+		{
+			PendingPrewarms.RemoveAt(0);
+		}
+	}
+	while (PendingPrewarms.Num() > 0 && FPlatformTime::Seconds() - StartTime < BudgetSeconds);
+
+	if (PendingPrewarms.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("✅ [ObjectPool] 예열 완료: %d개"), PrewarmBatchDone);
+		OnPrewarmCompleted.Broadcast();
+	}
+}
+#pragma endregion 예열 (Prewarm)
+
+#pragma region 용량 관리
+void UObjectPoolSubsystem::SetPoolCapacity(UClass* Class, int32 Capacity)
+{
+	const FPoolClassHandle PoolHandle = ResolvePoolHandle(Class);
+	if (!PoolHandle.IsValid()) return;
+
+	FObjectPoolQueue& PoolQueue = Pools[PoolHandle.Index];
+	PoolQueue.Capacity = Capacity;
+
+	const int32 EffectiveCapacity = GetEffectiveCapacity(PoolQueue);
+	if (EffectiveCapacity > 0 && PoolQueue.NumPooled() > EffectiveCapacity)
+	{
+		DestroyPooledActors(PoolQueue, PoolQueue.NumPooled() - EffectiveCapacity);
+	}
+}
+
+void UObjectPoolSubsystem::TrimPools(bool bAggressive)
+{
+	for (FObjectPoolQueue& PoolQueue : Pools)
+	{
+		const int32 Keep = bAggressive ? 0 : FMath::Min(PoolQueue.MinRetain, PoolQueue.NumPooled());
+		DestroyPooledActors(PoolQueue, PoolQueue.NumPooled() - Keep);
+	}
+}
+
+int64 UObjectPoolSubsystem::GetEstimatedPooledBytes() const
+{
+	int64 TotalBytes = 0;
+	for (const FObjectPoolQueue& PoolQueue : Pools)
+	{
+		TotalBytes += PoolQueue.Stats.EstimatedBytesPerActor * PoolQueue.NumPooled();
+	}
+	return TotalBytes;
+}
+
+void UObjectPoolSubsystem::TrimIdleActors(double Now)
+{
+	const double IdleSeconds = CVarPoolIdleTrimSeconds.GetValueOnGameThread();
+	if (IdleSeconds <= 0.0) return;
+
+	for (FObjectPoolQueue& PoolQueue : Pools)
+	{
+		// PooledSince는 반납 순서대로 쌓이므로 앞에서부터 만료된 것만 세면 됩니다.
+		const int32 MaxRemovable = PoolQueue.NumPooled() - PoolQueue.MinRetain;
+		int32 NumExpired = 0;
+		while (NumExpired < MaxRemovable && Now - PoolQueue.PooledSince[NumExpired] > IdleSeconds)
+		{
+			++NumExpired;
+		}
+
+		DestroyPooledActors(PoolQueue, NumExpired);
+	}
+}
+
+void UObjectPoolSubsystem::EnforceMemoryBudget()
+{
+	const int64 BudgetBytes = static_cast<int64>(CVarPoolMemoryBudgetMB.GetValueOnGameThread() * 1024.0 * 1024.0);
+	if (BudgetBytes <= 0) return;
+
+	int64 TotalBytes = GetEstimatedPooledBytes();
+	if (TotalBytes <= BudgetBytes) return;
+
+	// 가장 오래 쓰지 않은 클래스부터 통째로 비웁니다.
+	TArray<int32> ByLastUse;
+	for (int32 PoolIndex = 0; PoolIndex < Pools.Num(); ++PoolIndex)
+	{
+		if (Pools[PoolIndex].NumPooled() > 0)
+		{
+			ByLastUse.Add(PoolIndex);
+		}
+	}
+	ByLastUse.Sort([this](int32 A, int32 B)
+	{
+		return Pools[A].LastUsedTime < Pools[B].LastUsedTime;
+	});
+
+	for (const int32 PoolIndex : ByLastUse)
+	{
+		if (TotalBytes <= BudgetBytes) break;
+
+		FObjectPoolQueue& PoolQueue = Pools[PoolIndex];
+		TotalBytes -= PoolQueue.Stats.EstimatedBytesPerActor * PoolQueue.NumPooled();
+		UE_LOG(LogTemp, Log, TEXT("🧹 [ObjectPool] 메모리 예산 초과 - LRU 퇴출: %s (%d개)"),
+			*GetNameSafe(PoolQueue.Stats.PoolClass), PoolQueue.NumPooled());
+		DestroyPooledActors(PoolQueue, PoolQueue.NumPooled());
+	}
+}
+
+void UObjectPoolSubsystem::DestroyPooledActors(FObjectPoolQueue& PoolQueue, int32 Count)
+{
+	if (Count <= 0) return;
+
+	TArray<int32> Removed;
+	PoolQueue.RemoveOldest(Count, Removed);
+	for (const int32 SlotIndex : Removed)
+	{
+		AActor* Actor = Slots[SlotIndex].Actor;
+		FreeSlot(SlotIndex);
+		if (IsValid(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+
+	PoolQueue.Stats.TrimmedCount += Removed.Num();
+	ObjectPoolStats::SetPooled(PoolQueue.Stats, PoolQueue.NumPooled());
+}
+
+int32 UObjectPoolSubsystem::GetEffectiveCapacity(const FObjectPoolQueue& PoolQueue) const
+{
+	const int32 Capacity = PoolQueue.Capacity > 0 ? PoolQueue.Capacity : CVarPoolDefaultCapacity.GetValueOnGameThread();
+
+	// 예열 요청량보다 작게 잡히면 예열한 액터가 반납 시 바로 파괴되므로 최소 보유량까지는 허용합니다.
+	return Capacity > 0 ? FMath::Max(Capacity, PoolQueue.MinRetain) : 0;
+}
+
+void UObjectPoolSubsystem::HandleLowMemory()
+{
+	bPendingLowMemoryTrim = true;
+}
+#pragma endregion 용량 관리
+
+#pragma region 통계
+bool UObjectPoolSubsystem::GetPoolStats(UClass* Class, FObjectPoolClassStats& OutStats) const
+{
+	if (const int32* PoolIndex = PoolIndexMap.Find(Class))
+	{
+		OutStats = Pools[*PoolIndex].Stats;
+		return true;
+	}
+	return false;
+}
+
+TArray<FObjectPoolClassStats> UObjectPoolSubsystem::GetAllPoolStats() const
+{
+	TArray<FObjectPoolClassStats> Result;
+	Result.Reserve(Pools.Num());
+	for (const FObjectPoolQueue& PoolQueue : Pools)
+	{
+		if (PoolQueue.bBenchmarkOnly) continue;
+		Result.Add(PoolQueue.Stats);
+	}
+	return Result;
+}
+
+void UObjectPoolSubsystem::ResetPoolStats()
+{
+	for (FObjectPoolQueue& PoolQueue : Pools)
+	{
+		FObjectPoolClassStats& Stats = PoolQueue.Stats;
+		Stats.HitCount = 0;
+		Stats.MissCount = 0;
+		Stats.InvalidDiscardCount = 0;
+		Stats.TrimmedCount = 0;
+		Stats.RejectedReturnCount = 0;
+		Stats.TotalMissSpawnTimeMs = 0.f;
+		Stats.MaxMissSpawnTimeMs = 0.f;
+		Stats.PeakPooled = Stats.NumPooled;
+		Stats.PeakActive = Stats.NumActive;
+	}
+}
+
+void UObjectPoolSubsystem::DumpPoolStats() const
+{
+	TArray<FObjectPoolClassStats> AllStats = GetAllPoolStats();
+
+	// 미스가 많은 클래스(= 풀을 키워야 할 후보)가 위로 오도록 정렬
+	AllStats.Sort([](const FObjectPoolClassStats& A, const FObjectPoolClassStats& B)
+	{
+		return A.MissCount > B.MissCount;
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("===== [ObjectPool] 통계 (%s) - %d개 클래스, 대기 메모리 추정 %.2f MB ====="),
+		*GetWorld()->GetName(), AllStats.Num(), GetEstimatedPooledBytes() / (1024.0 * 1024.0));
+	for (const FObjectPoolClassStats& Stats : AllStats)
+	{
+		const float AvgMissMs = Stats.MissCount > 0 ? Stats.TotalMissSpawnTimeMs / Stats.MissCount : 0.f;
+		UE_LOG(LogTemp, Log,
+			TEXT("%-40s Hit %5d (%.1f%%) | Miss %5d | Discard %3d | Trimmed %3d | Rejected %3d | Pooled %3d (Peak %3d) | Active %3d (Peak %3d) | MissSpawn avg %.3f ms, max %.3f ms, total %.1f ms"),
+			*GetNameSafe(Stats.PoolClass),
+			Stats.HitCount, Stats.GetHitRate() * 100.f, Stats.MissCount, Stats.InvalidDiscardCount, Stats.TrimmedCount, Stats.RejectedReturnCount,
+			Stats.NumPooled, Stats.PeakPooled, Stats.NumActive, Stats.PeakActive,
+			AvgMissMs, Stats.MaxMissSpawnTimeMs, Stats.TotalMissSpawnTimeMs);
+	}
+}
+
+void UObjectPoolSubsystem::RunSpawnBenchmark(UClass* Class, int32 SpawnsPerSecond)
+{
+	if (!Class || !Class->ImplementsInterface(UObjectPoolInterface::StaticClass()))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [ObjectPool] 벤치마크 불가 - 클래스가 없거나 인터페이스 미구현: %s"), *GetNameSafe(Class));
+		return;
+	}
+
+	// 벤치 액터의 활성화 훅이 격자/사망 이벤트/LOD 등에 잠깐씩 등록되므로 게임이 진행 중일 때는 돌리지 않습니다.
+	const UWorld* World = GetWorld();
+	if (World->IsGameWorld() && World->HasBegunPlay() && !World->IsPaused())
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ [ObjectPool] 벤치마크 불가 - 게임 진행 중입니다. 일시정지(pause) 후 다시 실행하세요."));
+		return;
+	}
+
+	// 게임이 쓰는 풀과 분리된 전용 풀에서 측정 (실제 풀의 보유 액터/통계를 건드리지 않음)
+	const FPoolClassHandle PoolHandle = ResolveBenchmarkPoolHandle(Class);
+	const FVector BenchLocation(0.f, 0.f, -100000.f);
+
+	// 측정 대상은 재사용 경로이므로, SpawnActor 비용이 섞이지 않도록 액터 1개를 미리 확보해 둡니다.
+	FPooledActorHandle WarmHandle;
+	if (!SpawnFromPool(PoolHandle, BenchLocation, FRotator::ZeroRotator, nullptr, nullptr, &WarmHandle)) return;
+	ReleaseToPool(WarmHandle);
+
+	// 1) 이전 방식: TMap 조회 + IsValid 루프 + Implements<> + Execute_ (리플렉션)
+	AActor* BenchActor = SpawnFromPool(PoolHandle, BenchLocation, FRotator::ZeroRotator, nullptr, nullptr, &WarmHandle);
+	TMap<UClass*, TArray<AActor*>> LegacyPoolMap;
+	LegacyPoolMap.FindOrAdd(Class).Push(BenchActor);
+	IObjectPoolInterface::Execute_OnPoolDeactivate(BenchActor);
+
+	const uint64 LegacyStart = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnsPerSecond; ++i)
+	{
+		TArray<AActor*>& LegacyQueue = LegacyPoolMap.FindOrAdd(Class);
+		AActor* Pooled = nullptr;
+		while (LegacyQueue.Num() > 0)
+		{
+			AActor* Candidate = LegacyQueue.Pop();
+			if (IsValid(Candidate)) { Pooled = Candidate; break; }
+		}
+		Pooled->SetActorLocationAndRotation(BenchLocation, FRotator::ZeroRotator);
+		if (Pooled->Implements<UObjectPoolInterface>())
+		{
+			IObjectPoolInterface::Execute_OnPoolActivate(Pooled);
+		}
+
+		if (Pooled->Implements<UObjectPoolInterface>())
+		{
+			IObjectPoolInterface::Execute_OnPoolDeactivate(Pooled);
+		}
+		LegacyPoolMap.FindOrAdd(Pooled->GetClass()).Push(Pooled);
+	}
+	const double LegacyMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - LegacyStart);
+
+	// 벤치 액터를 핸들 풀로 되돌림 (현재 비활성 상태이므로 슬롯만 활성으로 되돌린 뒤 반납)
+	IObjectPoolInterface::Execute_OnPoolActivate(BenchActor);
+	ReleaseToPool(WarmHandle);
+
+	// 2) 핸들 방식: 캐싱된 핸들 + 슬롯 배열 + 네이티브 가상 호출
+	const uint64 HandleStart = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < SpawnsPerSecond; ++i)
+	{
+		FPooledActorHandle ActorHandle;
+		SpawnFromPool(PoolHandle, BenchLocation, FRotator::ZeroRotator, nullptr, nullptr, &ActorHandle);
+		ReleaseToPool(ActorHandle);
+	}
+	const double HandleMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - HandleStart);
+
+	// 벤치 액터는 월드에 남기지 않음 (전용 풀은 다음 측정 때 다시 씀)
+	FObjectPoolQueue& BenchQueue = Pools[PoolHandle.Index];
+	DestroyPooledActors(BenchQueue, BenchQueue.NumPooled());
+
+	const TCHAR* DispatchName = Pools[PoolHandle.Index].DispatchMode == EPoolDispatchMode::Native ? TEXT("Native") : TEXT("Reflection");
+	UE_LOG(LogTemp, Log, TEXT("===== [ObjectPool] 스폰 벤치마크: %s (%d회 = 초당 %d 스폰, 디스패치: %s) ====="),
+		*Class->GetName(), SpawnsPerSecond, SpawnsPerSecond, DispatchName);
+	UE_LOG(LogTemp, Log, TEXT(" - 이전 방식 : 1회 %.3f us | 초당 %.3f ms"),
+		LegacyMs * 1000.0 / SpawnsPerSecond, LegacyMs);
+	UE_LOG(LogTemp, Log, TEXT(" - 핸들 방식 : 1회 %.3f us | 초당 %.3f ms (%.1f%%)"),
+		HandleMs * 1000.0 / SpawnsPerSecond, HandleMs, LegacyMs > 0.0 ? HandleMs / LegacyMs * 100.0 : 0.0);
+}
+#pragma endregion 통계
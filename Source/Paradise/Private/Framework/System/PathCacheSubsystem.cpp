@@ -0,0 +1,250 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/PathCacheSubsystem.h"
+#include "AIController.h"
+#include "AITypes.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadisePathCache"), STATGROUP_ParadisePathCache, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Find Path"), STAT_PathCache_Find, STATGROUP_ParadisePathCache);
+DECLARE_CYCLE_STAT(TEXT("Find Path (Miss, Pathfinding)"), STAT_PathCache_Pathfind, STATGROUP_ParadisePathCache);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entries"), STAT_PathCache_Entries, STATGROUP_ParadisePathCache);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hits"), STAT_PathCache_Hits, STATGROUP_ParadisePathCache);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Misses"), STAT_PathCache_Misses, STATGROUP_ParadisePathCache);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Splice Rejected"), STAT_PathCache_SpliceRejected, STATGROUP_ParadisePathCache);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Invalidations"), STAT_PathCache_Invalidations, STATGROUP_ParadisePathCache);
+
+static TAutoConsoleVariable<int32> CVarPathCacheEnable(
+	TEXT("paradise.nav.pathcache.Enable"),
+	1,
+	TEXT("1이면 같은 출발/도착 폴리곤의 경로를 캐시에서 재사용합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPathCacheMaxAge(
+	TEXT("paradise.nav.pathcache.MaxAge"),
+	10.f,
+	TEXT("캐시 항목 유지 시간(초). 지나면 다음 요청에서 새로 탐색합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPathCacheMaxEntries(
+	TEXT("paradise.nav.pathcache.MaxEntries"),
+	256,
+	TEXT("캐시 최대 항목 수. 넘으면 가장 오래 사용하지 않은 항목부터 제거합니다."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorld GPathCacheStatsCommand(
+	TEXT("paradise.nav.pathcache.Stats"),
+	TEXT("경로 캐시 항목 수와 적중률을 출력합니다."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UPathCacheSubsystem* PathCache = World ? World->GetSubsystem<UPathCacheSubsystem>() : nullptr;
+		if (!PathCache) return;
+
+		const int64 Total = PathCache->GetNumHits() + PathCache->GetNumMisses();
+		const double HitRate = Total > 0 ? 100.0 * PathCache->GetNumHits() / Total : 0.0;
+		UE_LOG(LogTemp, Log, TEXT("🗺️ [PathCache] 항목 %d | 적중 %lld / 실패 %lld (적중률 %.1f%%)"),
+			PathCache->GetNumEntries(), PathCache->GetNumHits(), PathCache->GetNumMisses(), HitRate);
+	}));
+
+void UPathCacheSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UPathCacheSubsystem::HandleNavigationGenerationFinished);
+	}
+}
+
+void UPathCacheSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UPathCacheSubsystem::HandleNavigationGenerationFinished);
+	}
+
+	Invalidate();
+
+	// 누적 통계는 월드(PIE 세션)마다 새로 셈
+	SET_DWORD_STAT(STAT_PathCache_Hits, 0);
+	SET_DWORD_STAT(STAT_PathCache_Misses, 0);
+	SET_DWORD_STAT(STAT_PathCache_SpliceRejected, 0);
+	SET_DWORD_STAT(STAT_PathCache_Invalidations, 0);
+
+	Super::Deinitialize();
+}
+
+void UPathCacheSubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+	Invalidate();
+	INC_DWORD_STAT(STAT_PathCache_Invalidations);
+}
+
+void UPathCacheSubsystem::Invalidate()
+{
+	Entries.Reset();
+	SET_DWORD_STAT(STAT_PathCache_Entries, 0);
+}
+
+bool UPathCacheSubsystem::FindMovePath(const AAIController& Controller, const FAIMoveRequest& MoveRequest, FNavPathSharedPtr& OutPath)
+{
+	if (!MoveRequest.IsUsingPathfinding() || MoveRequest.GetNavigationFilter()) return false;
+
+	const UWorld* World = Controller.GetWorld();
+	UPathCacheSubsystem* PathCache = World ? World->GetSubsystem<UPathCacheSubsystem>() : nullptr;
+	if (!PathCache) return false;
+
+	const AActor* GoalActor = MoveRequest.IsMoveToActorRequest() ? MoveRequest.GetGoalActor() : nullptr;
+	if (MoveRequest.IsMoveToActorRequest() && !GoalActor) return false;
+
+	const FVector GoalLocation = GoalActor ? GoalActor->GetActorLocation() : MoveRequest.GetGoalLocation();
+	OutPath = PathCache->FindPath(Controller, GoalLocation, MoveRequest.IsUsingPartialPath());
+	return OutPath.IsValid();
+}
+
+FNavPathSharedPtr UPathCacheSubsystem::FindPath(const AAIController& Controller, const FVector& GoalLocation, bool bAllowPartialPath)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PathCache_Find);
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys || CVarPathCacheEnable.GetValueOnGameThread() == 0) return nullptr;
+
+	const FVector StartLocation = Controller.GetNavAgentLocation();
+	const ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(NavSys->GetNavDataForProps(Controller.GetNavAgentPropertiesRef(), StartLocation));
+	if (!NavMesh) return nullptr;
+
+	FSharedConstNavQueryFilter Filter = UNavigationQueryFilter::GetQueryFilter(*NavMesh, &Controller, nullptr);
+	const FVector QueryExtent = NavMesh->GetDefaultQueryExtent();
+
+	FPathCacheKey Key;
+	Key.StartPoly = NavMesh->FindNearestPoly(StartLocation, QueryExtent, Filter, &Controller);
+	Key.GoalPoly = NavMesh->FindNearestPoly(GoalLocation, QueryExtent, Filter, &Controller);
+	if (Key.StartPoly == INVALID_NAVNODEREF || Key.GoalPoly == INVALID_NAVNODEREF) return nullptr;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// 1. 같은 폴리곤 쌍의 통로가 있으면 양 끝만 바꿔 재사용
+	if (FPathCacheEntry* Entry = Entries.Find(Key))
+	{
+		if (Now - Entry->CreatedTime <= CVarPathCacheMaxAge.GetValueOnGameThread())
+		{
+			const FNavPathPoint Start(StartLocation, Key.StartPoly);
+			const FNavPathPoint Goal(GoalLocation, Key.GoalPoly);
+			if (FNavPathSharedPtr Spliced = SplicePath(*Entry, *NavMesh, Filter, Controller, Start, Goal))
+			{
+				Entry->LastUsedTime = Now;
+				++NumHits;
+				INC_DWORD_STAT(STAT_PathCache_Hits);
+				return Spliced;
+			}
+			INC_DWORD_STAT(STAT_PathCache_SpliceRejected);
+		}
+		Entries.Remove(Key);
+	}
+
+	// 2. 캐시 실패 → 일반 경로 탐색 후 저장
+	++NumMisses;
+	INC_DWORD_STAT(STAT_PathCache_Misses);
+
+	FPathFindingResult Result;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PathCache_Pathfind);
+
+		FPathFindingQuery Query(&Controller, *NavMesh, StartLocation, GoalLocation, Filter);
+		Query.SetAllowPartialPaths(bAllowPartialPath);
+		Result = NavSys->FindPathSync(Query);
+	}
+
+	if (!Result.IsSuccessful() || !Result.Path.IsValid()) return nullptr;
+
+	// 부분 경로는 다음 유닛에게 물려주지 않음
+	if (!Result.IsPartial())
+	{
+		StoreEntry(Key, *Result.Path, Now);
+	}
+	return Result.Path;
+}
+
+FNavPathSharedPtr UPathCacheSubsystem::SplicePath(const FPathCacheEntry& Entry, const ARecastNavMesh& NavMesh, FSharedConstNavQueryFilter Filter,
+	const AAIController& Controller, const FNavPathPoint& Start, const FNavPathPoint& Goal) const
+{
+	const int32 NumPoints = Entry.Points.Num();
+	if (NumPoints < 2) return nullptr;
+
+	// 새 출발점 → 첫 모서리, 마지막 모서리 → 새 도착점 구간이 뚫려 있는지 확인
+	// (통로가 직선(점 2개)이면 출발 → 도착 한 구간만)
+	FVector HitLocation;
+	const FVector& FirstCorner = NumPoints > 2 ? Entry.Points[1].Location : Goal.Location;
+	if (NavMesh.Raycast(Start.Location, FirstCorner, HitLocation, Filter, &Controller)) return nullptr;
+
+	if (NumPoints > 2 && NavMesh.Raycast(Entry.Points[NumPoints - 2].Location, Goal.Location, HitLocation, Filter, &Controller)) return nullptr;
+
+	FNavMeshPath* NavMeshPath = new FNavMeshPath();
+	FNavPathSharedPtr Path = MakeShareable(NavMeshPath);
+
+	TArray<FNavPathPoint>& Points = NavMeshPath->GetPathPoints();
+	Points.Reserve(NumPoints);
+	Points.Add(Start);
+	for (int32 Index = 1; Index < NumPoints - 1; ++Index)
+	{
+		Points.Add(Entry.Points[Index]);
+	}
+	Points.Add(Goal);
+
+	NavMeshPath->PathCorridor = Entry.Corridor;
+	NavMeshPath->PathCorridorCost = Entry.CorridorCost;
+	NavMeshPath->SetNavigationDataUsed(&NavMesh);
+	NavMeshPath->SetQuerier(&Controller);
+	NavMeshPath->SetFilter(Filter);
+	NavMeshPath->SetTimeStamp(NavMesh.GetWorldTimeStamp());
+	NavMeshPath->MarkReady();
+
+	// 탐색으로 만든 경로와 똑같이 네비메시 갱신 시 무효화 알림을 받도록 등록
+	const_cast<ARecastNavMesh&>(NavMesh).RegisterActivePath(Path);
+
+	return Path;
+}
+
+void UPathCacheSubsystem::StoreEntry(const FPathCacheKey& Key, const FNavigationPath& Path, double Now)
+{
+	const FNavMeshPath* NavMeshPath = Path.CastPath<FNavMeshPath>();
+	if (!NavMeshPath || NavMeshPath->GetPathPoints().Num() < 2) return;
+
+	FPathCacheEntry& Entry = Entries.Add(Key);
+	Entry.Points = NavMeshPath->GetPathPoints();
+	Entry.Corridor = NavMeshPath->PathCorridor;
+	Entry.CorridorCost = NavMeshPath->PathCorridorCost;
+	Entry.CreatedTime = Now;
+	Entry.LastUsedTime = Now;
+
+	EvictIfNeeded();
+	SET_DWORD_STAT(STAT_PathCache_Entries, Entries.Num());
+}
+
+void UPathCacheSubsystem::EvictIfNeeded()
+{
+	const int32 MaxEntries = FMath::Max(1, CVarPathCacheMaxEntries.GetValueOnGameThread());
+	while (Entries.Num() > MaxEntries)
+	{
+		const FPathCacheKey* OldestKey = nullptr;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (const TPair<FPathCacheKey, FPathCacheEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUsedTime < OldestTime)
+			{
+				OldestTime = Pair.Value.LastUsedTime;
+				OldestKey = &Pair.Key;
+			}
+		}
+
+		if (!OldestKey) break;
+		Entries.Remove(FPathCacheKey(*OldestKey));
+	}
+}
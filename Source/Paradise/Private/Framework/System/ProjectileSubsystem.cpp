@@ -0,0 +1,514 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/ProjectileSubsystem.h"
+#include "Framework/System/CrowdSubsystem.h"
+#include "Framework/System/DamageQueueSubsystem.h"
+#include "Data/Assets/ProjectileConfig.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/ParadiseFactionTable.h"
+#include "GAS/System/ParadiseGameplayTags.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameplayEffect.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseProjectile"), STATGROUP_ParadiseProjectile, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Projectile Total"), STAT_Projectile_Tick, STATGROUP_ParadiseProjectile);
+DECLARE_CYCLE_STAT(TEXT("Trace Results"), STAT_Projectile_Results, STATGROUP_ParadiseProjectile);
+DECLARE_CYCLE_STAT(TEXT("Integrate"), STAT_Projectile_Integrate, STATGROUP_ParadiseProjectile);
+DECLARE_CYCLE_STAT(TEXT("Issue Traces"), STAT_Projectile_Issue, STATGROUP_ParadiseProjectile);
+DECLARE_CYCLE_STAT(TEXT("Update Instances"), STAT_Projectile_Instances, STATGROUP_ParadiseProjectile);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectiles"), STAT_Projectile_Count, STATGROUP_ParadiseProjectile);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hits / Frame"), STAT_Projectile_Hits, STATGROUP_ParadiseProjectile);
+
+static TAutoConsoleVariable<int32> CVarProjectileMax(
+	TEXT("paradise.projectile.MaxProjectiles"),
+	2000,
+	TEXT("동시에 비행할 수 있는 최대 투사체 수. 넘으면 발사가 무시됩니다."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs GProjectileStressCommand(
+	TEXT("paradise.projectile.stress"),
+	TEXT("플레이어 주변에서 투사체 N개가 항상 날아다니도록 계속 발사합니다. 부하는 'stat ParadiseProjectile'로 확인. (0 = 정리)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UProjectileSubsystem* Projectiles = World ? World->GetSubsystem<UProjectileSubsystem>() : nullptr;
+		if (!Projectiles) return;
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000;
+		Projectiles->StartStressTest(Count);
+	}));
+
+#pragma region FProjectileArray
+int32 FProjectileArray::Add(const FVector& InLocation, const FVector& InVelocity, float InDamage, uint16 InTypeIndex, uint8 InFactionId, uint16 InEffectIndex, AActor* InInstigator)
+{
+	PrevLocation.Add(InLocation);
+	Velocity.Add(InVelocity);
+	Age.Add(0.f);
+	Damage.Add(InDamage);
+	TypeIndex.Add(InTypeIndex);
+	FactionId.Add(InFactionId);
+	EffectIndex.Add(InEffectIndex);
+	Instigator.Add(InInstigator);
+	PendingTrace.AddDefaulted();
+	return Location.Add(InLocation);
+}
+
+void FProjectileArray::RemoveAtSwap(int32 Index)
+{
+	Location.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PrevLocation.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocity.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Age.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damage.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TypeIndex.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FactionId.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	EffectIndex.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigator.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PendingTrace.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FProjectileArray::Reset()
+{
+	Location.Reset();
+	PrevLocation.Reset();
+	Velocity.Reset();
+	Age.Reset();
+	Damage.Reset();
+	TypeIndex.Reset();
+	FactionId.Reset();
+	EffectIndex.Reset();
+	Instigator.Reset();
+	PendingTrace.Reset();
+}
+#pragma endregion FProjectileArray
+
+void UProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 유닛 캡슐(군중 모드면 CrowdUnit 채널)은 겹침으로 받아 아군을 통과하고, 지형은 그대로 막힘
+	TraceResponseParams.CollisionResponse.SetResponse(ECC_Pawn, ECR_Overlap);
+	TraceResponseParams.CollisionResponse.SetResponse(ECC_CrowdUnit, ECR_Overlap);
+
+	// 플레이어 캐릭터는 진영 태그가 없으므로 FCharacterStats 기본 진영으로 취급
+	PlayerFactionId = FParadiseFactionTable::Get().FindOrAddFaction(FParadiseGameplayTags::Get().Unit_Faction_Friendly_Player);
+
+	SetConfig(nullptr);
+}
+
+void UProjectileSubsystem::Deinitialize()
+{
+	Projectiles.Reset();
+	Types.Reset();
+	TypeIndexByTag.Reset();
+	DamageEffects.Reset();
+	WarnedNoEffectClasses.Reset();
+	InstanceOwner = nullptr;
+	StressCount = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UProjectileSubsystem::SetConfig(const UProjectileConfig* InConfig)
+{
+	ClearProjectiles();
+
+	for (FProjectileType& Type : Types)
+	{
+		if (IsValid(Type.Instances))
+		{
+			Type.Instances->DestroyComponent();
+		}
+	}
+	Types.Reset();
+	TypeIndexByTag.Reset();
+
+	AddType(FGameplayTag::EmptyTag, InConfig ? InConfig->DefaultType : FProjectileTypeSettings());
+
+	if (!InConfig) return;
+
+	for (const TPair<FGameplayTag, FProjectileTypeSettings>& Pair : InConfig->Types)
+	{
+		if (!Pair.Key.IsValid() || TypeIndexByTag.Contains(Pair.Key)) continue;
+		AddType(Pair.Key, Pair.Value);
+	}
+}
+
+void UProjectileSubsystem::AddType(const FGameplayTag& TypeTag, const FProjectileTypeSettings& Settings)
+{
+	if (Types.Num() >= MAX_uint16) return;
+
+	FProjectileType& Type = Types.AddDefaulted_GetRef();
+	Type.Tag = TypeTag;
+	Type.Settings = Settings;
+
+	if (TypeTag.IsValid())
+	{
+		TypeIndexByTag.Add(TypeTag, static_cast<uint16>(Types.Num() - 1));
+	}
+
+	if (Settings.Mesh.IsNull()) return;
+
+	UStaticMesh* Mesh = Settings.Mesh.LoadSynchronous();
+	AActor* Owner = Mesh ? GetOrCreateInstanceOwner() : nullptr;
+	if (!Owner)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ [Projectile] %s 종류의 메시를 준비하지 못했습니다. 보이지 않는 투사체로 처리합니다."), *TypeTag.ToString());
+		return;
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(Owner);
+	Instances->SetStaticMesh(Mesh);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCanEverAffectNavigation(false);
+	Instances->SetCastShadow(false);
+	Instances->SetupAttachment(Owner->GetRootComponent());
+	Instances->RegisterComponent();
+	Owner->AddInstanceComponent(Instances);
+
+	Type.Instances = Instances;
+}
+
+AActor* UProjectileSubsystem::GetOrCreateInstanceOwner()
+{
+	if (IsValid(InstanceOwner)) return InstanceOwner;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	InstanceOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!InstanceOwner) return nullptr;
+
+	// 인스턴스 트랜스폼은 월드 좌표로 넣으므로 루트는 원점에 고정
+	USceneComponent* Root = NewObject<USceneComponent>(InstanceOwner, TEXT("ProjectileRoot"));
+	Root->SetMobility(EComponentMobility::Static);
+	InstanceOwner->SetRootComponent(Root);
+	Root->RegisterComponent();
+
+	return InstanceOwner;
+}
+
+uint16 UProjectileSubsystem::FindTypeIndex(const FGameplayTag& TypeTag) const
+{
+	const uint16* Found = TypeTag.IsValid() ? TypeIndexByTag.Find(TypeTag) : nullptr;
+	return Found ? *Found : 0;
+}
+
+const FProjectileTypeSettings& UProjectileSubsystem::GetTypeSettings(const FGameplayTag& TypeTag) const
+{
+	return Types[FindTypeIndex(TypeTag)].Settings;
+}
+
+bool UProjectileSubsystem::FireProjectile(AActor* Shooter, const FGameplayTag& TypeTag, const FVector& Start, const FVector& Direction,
+	float Damage, uint8 FactionId, TSubclassOf<UGameplayEffect> DamageEffect)
+{
+	if (Projectiles.Num() >= CVarProjectileMax.GetValueOnGameThread()) return false;
+
+	const FVector LaunchDirection = Direction.GetSafeNormal();
+	if (LaunchDirection.IsNearlyZero()) return false;
+
+	uint16 EffectIndex = MAX_uint16;
+	if (DamageEffect)
+	{
+		int32 Existing = DamageEffects.IndexOfByKey(DamageEffect);
+		if (Existing == INDEX_NONE && DamageEffects.Num() < MAX_uint16)
+		{
+			Existing = DamageEffects.Add(DamageEffect);
+		}
+		EffectIndex = Existing != INDEX_NONE ? static_cast<uint16>(Existing) : MAX_uint16;
+	}
+	else if (Shooter)
+	{
+		// 플레이어 등 ASC 대상은 GE로만 피해를 받으므로, 빠져 있으면 맞아도 데미지가 없음
+		WarnMissingDamageEffect(Shooter);
+	}
+
+	const uint16 TypeIndex = FindTypeIndex(TypeTag);
+	Projectiles.Add(Start, LaunchDirection * Types[TypeIndex].Settings.Speed, Damage, TypeIndex, FactionId, EffectIndex, Shooter);
+	return true;
+}
+
+void UProjectileSubsystem::ClearProjectiles()
+{
+	Projectiles.Reset();
+	Removed.Reset();
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Projectile_Tick);
+
+	Super::Tick(DeltaTime);
+
+	TickStressTest();
+
+	// 순서: 지난 프레임 스윕 결과 → 제거 → 이동 → 이번 구간 스윕 발행 (제거 후 발행하므로 핸들 인덱스가 어긋나지 않음)
+	ProcessTraceResults();
+	RemoveFinished();
+	Integrate(DeltaTime);
+	IssueTraces();
+	UpdateInstances();
+
+	SET_DWORD_STAT(STAT_Projectile_Count, Projectiles.Num());
+}
+
+#pragma region 시뮬레이션
+void UProjectileSubsystem::ProcessTraceResults()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Projectile_Results);
+
+	const int32 NumProjectiles = Projectiles.Num();
+	Removed.Init(false, NumProjectiles);
+
+	UWorld* World = GetWorld();
+	const FParadiseFactionTable& Factions = FParadiseFactionTable::Get();
+	FTraceDatum Datum;
+
+	for (int32 Index = 0; Index < NumProjectiles; ++Index)
+	{
+		FTraceHandle& Handle = Projectiles.PendingTrace[Index];
+		if (!Handle.IsValid()) continue;
+
+		const bool bReady = World->QueryTraceData(Handle, Datum);
+		Handle = FTraceHandle();
+		if (!bReady) continue;
+
+		// 결과는 시간 순 (겹침들 → 마지막에 막힌 지점)
+		for (const FHitResult& Hit : Datum.OutHits)
+		{
+			AActor* HitActor = Hit.GetActor();
+
+			uint8 TargetFactionId = FParadiseFactionTable::InvalidId;
+			if (const ABaseUnit* Unit = Cast<ABaseUnit>(HitActor))
+			{
+				TargetFactionId = Unit->bIsDead ? FParadiseFactionTable::InvalidId : Unit->FactionId;
+			}
+			else if (UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor))
+			{
+				TargetFactionId = PlayerFactionId;
+			}
+
+			if (Factions.IsHostile(Projectiles.FactionId[Index], TargetFactionId))
+			{
+				ApplyHit(Index, HitActor);
+				Removed[Index] = true;
+				break;
+			}
+
+			// 지형/구조물에 막힘
+			if (Hit.bBlockingHit)
+			{
+				Removed[Index] = true;
+				break;
+			}
+		}
+	}
+}
+
+void UProjectileSubsystem::ApplyHit(int32 Index, AActor* HitActor)
+{
+	INC_DWORD_STAT(STAT_Projectile_Hits);
+
+	AActor* Shooter = Projectiles.Instigator[Index].Get();
+	const float Damage = Projectiles.Damage[Index];
+	const uint16 EffectIndex = Projectiles.EffectIndex[Index];
+
+	// ASC가 있는 대상: 근접 공격과 같은 GE/ExecCalcCombat 경로 (쏜 유닛은 ASC가 없으므로 공격력을 SetByCaller로 전달)
+	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
+	if (TargetASC && DamageEffects.IsValidIndex(EffectIndex) && DamageEffects[EffectIndex])
+	{
+		FGameplayEffectContextHandle Context = TargetASC->MakeEffectContext();
+		Context.AddInstigator(Shooter, Shooter);
+
+		FGameplayEffectSpec Spec(DamageEffects[EffectIndex]->GetDefaultObject<UGameplayEffect>(), Context, 1.f);
+		Spec.SetSetByCallerMagnitude(FParadiseGameplayTags::Get().Data_Damage_Multiplier, 1.f);
+		Spec.SetSetByCallerMagnitude(FParadiseGameplayTags::Get().Data_Damage_Base, Damage);
+		TargetASC->ApplyGameplayEffectSpecToSelf(Spec);
+		return;
+	}
+
+	ABaseUnit* TargetUnit = Cast<ABaseUnit>(HitActor);
+	if (!TargetUnit)
+	{
+		// ASC 대상인데 적용할 GE가 없음 (데미지 큐는 AI 유닛만 처리)
+		WarnMissingDamageEffect(Shooter);
+		return;
+	}
+
+	// AI 유닛: 근접 공격과 같이 데미지 큐에 게시 (프레임 끝에 피해자 방어력으로 계산)
+	UDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UDamageQueueSubsystem>();
+	if (!DamageQueue) return;
+
+	FDamageRecord Record;
+	Record.Source = Shooter;
+	Record.Target = TargetUnit;
+	Record.AttackPower = Damage;
+	DamageQueue->PostDamage(Record);
+}
+
+void UProjectileSubsystem::WarnMissingDamageEffect(const AActor* Shooter)
+{
+	const UClass* ShooterClass = Shooter ? Shooter->GetClass() : nullptr;
+
+	bool bAlreadyWarned = false;
+	WarnedNoEffectClasses.Add(ShooterClass, &bAlreadyWarned);
+	if (bAlreadyWarned) return;
+
+	UE_LOG(LogTemp, Warning, TEXT("⚠️ [Projectile] %s 의 투사체에 BasicAttackEffect가 없습니다. ASC 대상(플레이어)에게는 데미지가 들어가지 않습니다."),
+		*GetNameSafe(ShooterClass));
+}
+
+void UProjectileSubsystem::RemoveFinished()
+{
+	// 뒤에서부터 지워야 RemoveAtSwap으로 당겨온 항목을 다시 검사하지 않음
+	for (int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+	{
+		const bool bHit = Removed.IsValidIndex(Index) && Removed[Index];
+		const bool bExpired = Projectiles.Age[Index] >= Types[Projectiles.TypeIndex[Index]].Settings.Lifetime;
+		if (bHit || bExpired)
+		{
+			Projectiles.RemoveAtSwap(Index);
+		}
+	}
+}
+
+void UProjectileSubsystem::Integrate(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Projectile_Integrate);
+
+	const int32 NumProjectiles = Projectiles.Num();
+	if (NumProjectiles == 0) return;
+
+	const float GravityZ = GetWorld()->GetGravityZ();
+
+	// 투사체마다 자기 슬롯만 씀
+	ParallelFor(NumProjectiles, [&](int32 Index)
+	{
+		FVector& Velocity = Projectiles.Velocity[Index];
+		Velocity.Z += GravityZ * Types[Projectiles.TypeIndex[Index]].Settings.GravityScale * DeltaTime;
+
+		Projectiles.PrevLocation[Index] = Projectiles.Location[Index];
+		Projectiles.Location[Index] += Velocity * DeltaTime;
+		Projectiles.Age[Index] += DeltaTime;
+	});
+}
+
+void UProjectileSubsystem::IssueTraces()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Projectile_Issue);
+
+	UWorld* World = GetWorld();
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ParadiseProjectile), false);
+
+	for (int32 Index = 0; Index < Projectiles.Num(); ++Index)
+	{
+		QueryParams.ClearIgnoredActors();
+		if (AActor* Shooter = Projectiles.Instigator[Index].Get())
+		{
+			QueryParams.AddIgnoredActor(Shooter);
+		}
+
+		const float Radius = Types[Projectiles.TypeIndex[Index]].Settings.Radius;
+		Projectiles.PendingTrace[Index] = World->AsyncSweepByChannel(EAsyncTraceType::Multi,
+			Projectiles.PrevLocation[Index], Projectiles.Location[Index], FQuat::Identity,
+			ECC_Pawn, FCollisionShape::MakeSphere(Radius), QueryParams, TraceResponseParams);
+	}
+}
+
+void UProjectileSubsystem::UpdateInstances()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Projectile_Instances);
+
+	for (FProjectileType& Type : Types)
+	{
+		Type.InstanceTransforms.Reset();
+	}
+
+	for (int32 Index = 0; Index < Projectiles.Num(); ++Index)
+	{
+		FProjectileType& Type = Types[Projectiles.TypeIndex[Index]];
+		if (!Type.Instances) continue;
+
+		Type.InstanceTransforms.Emplace(Projectiles.Velocity[Index].Rotation(), Projectiles.Location[Index], FVector(Type.Settings.Scale));
+	}
+
+	for (FProjectileType& Type : Types)
+	{
+		UInstancedStaticMeshComponent* Instances = Type.Instances;
+		if (!IsValid(Instances)) continue;
+
+		const int32 Current = Instances->GetInstanceCount();
+		const int32 Wanted = Type.InstanceTransforms.Num();
+		if (Current == 0 && Wanted == 0) continue;
+
+		// 인스턴스 순서는 의미가 없으므로 개수만 맞추고 전체 트랜스폼을 한 번에 덮어씀
+		if (Wanted > Current)
+		{
+			const TArray<FTransform> Added(Type.InstanceTransforms.GetData() + Current, Wanted - Current);
+			Instances->AddInstances(Added, false, true, false);
+		}
+		else if (Wanted < Current)
+		{
+			TArray<int32> RemovedInstances;
+			RemovedInstances.Reserve(Current - Wanted);
+			for (int32 InstanceIndex = Wanted; InstanceIndex < Current; ++InstanceIndex)
+			{
+				RemovedInstances.Add(InstanceIndex);
+			}
+			Instances->RemoveInstances(RemovedInstances);
+		}
+
+		if (Wanted > 0)
+		{
+			Instances->BatchUpdateInstancesTransforms(0, Type.InstanceTransforms, true, true, true);
+		}
+	}
+}
+#pragma endregion 시뮬레이션
+
+#pragma region 부하 측정
+void UProjectileSubsystem::StartStressTest(int32 Count)
+{
+	StressCount = FMath::Max(Count, 0);
+	if (StressCount == 0)
+	{
+		ClearProjectiles();
+		return;
+	}
+
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	const APawn* PlayerPawn = PC ? PC->GetPawn() : nullptr;
+	StressCenter = PlayerPawn ? PlayerPawn->GetActorLocation() : FVector::ZeroVector;
+
+	UE_LOG(LogTemp, Log, TEXT("🏹 [Projectile] 부하 측정 시작: 비행 중 투사체 %d개 유지"), StressCount);
+}
+
+void UProjectileSubsystem::TickStressTest()
+{
+	if (StressCount <= 0) return;
+
+	// 진영 없음(InvalidId)으로 쏘므로 유닛은 통과하고 지형에만 막힘
+	while (Projectiles.Num() < StressCount)
+	{
+		const FVector Offset(FMath::FRandRange(-1500.f, 1500.f), FMath::FRandRange(-1500.f, 1500.f), 150.f);
+		const FVector Direction(FMath::FRandRange(-1.f, 1.f), FMath::FRandRange(-1.f, 1.f), FMath::FRandRange(0.f, 0.2f));
+		if (!FireProjectile(nullptr, FGameplayTag::EmptyTag, StressCenter + Offset, Direction, 0.f, FParadiseFactionTable::InvalidId, nullptr)) break;
+	}
+}
+#pragma endregion 부하 측정
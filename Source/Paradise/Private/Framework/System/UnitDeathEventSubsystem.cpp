@@ -0,0 +1,155 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/UnitDeathEventSubsystem.h"
+#include "Framework/System/AIWorkSchedulerSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Framework/InGame/MyAIController.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/MonsterAI.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseUnitEvents"), STATGROUP_ParadiseUnitEvents, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Broadcast"), STAT_UnitEvents_Broadcast, STATGROUP_ParadiseUnitEvents);
+DECLARE_CYCLE_STAT(TEXT("Retarget"), STAT_UnitEvents_Retarget, STATGROUP_ParadiseUnitEvents);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Removals / Frame"), STAT_UnitEvents_Removals, STATGROUP_ParadiseUnitEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blackboards Cleared / Frame"), STAT_UnitEvents_Cleared, STATGROUP_ParadiseUnitEvents);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Watchers"), STAT_UnitEvents_Watchers, STATGROUP_ParadiseUnitEvents);
+
+void UUnitDeathEventSubsystem::Deinitialize()
+{
+	// 누적(Accumulator) 스탯은 프레임마다 초기화되지 않으므로 월드가 내려갈 때 직접 빼줍니다.
+	DEC_DWORD_STAT_BY(STAT_UnitEvents_Watchers, TargetByWatcher.Num());
+
+	WatchersByTarget.Reset();
+	TargetByWatcher.Reset();
+	OnUnitRemovedFromPlay.Clear();
+
+	Super::Deinitialize();
+}
+
+void UUnitDeathEventSubsystem::WatchTarget(AAIController* Watcher, AActor* Target)
+{
+	if (!Watcher) return;
+
+	if (const TObjectKey<AActor>* Current = TargetByWatcher.Find(Watcher))
+	{
+		if (Target && *Current == TObjectKey<AActor>(Target)) return;
+	}
+
+	UnwatchTarget(Watcher);
+	if (!Target) return;
+
+	WatchersByTarget.FindOrAdd(Target).Add(Watcher);
+	TargetByWatcher.Add(Watcher, Target);
+	INC_DWORD_STAT(STAT_UnitEvents_Watchers);
+}
+
+void UUnitDeathEventSubsystem::UnwatchTarget(const AAIController* Watcher)
+{
+	TObjectKey<AActor> Target;
+	if (!TargetByWatcher.RemoveAndCopyValue(Watcher, Target)) return;
+
+	DEC_DWORD_STAT(STAT_UnitEvents_Watchers);
+
+	if (TArray<TWeakObjectPtr<AAIController>>* Watchers = WatchersByTarget.Find(Target))
+	{
+		Watchers->RemoveAllSwap([Watcher](const TWeakObjectPtr<AAIController>& Entry) { return !Entry.IsValid() || Entry.Get() == Watcher; });
+		if (Watchers->Num() == 0)
+		{
+			WatchersByTarget.Remove(Target);
+		}
+	}
+}
+
+void UUnitDeathEventSubsystem::NotifyDeath(AActor* Actor)
+{
+	Broadcast(Actor, true);
+}
+
+void UUnitDeathEventSubsystem::NotifyDespawn(AActor* Actor)
+{
+	Broadcast(Actor, false);
+}
+
+void UUnitDeathEventSubsystem::Broadcast(AActor* Actor, bool bDied)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UnitEvents_Broadcast);
+
+	if (!Actor) return;
+
+	INC_DWORD_STAT(STAT_UnitEvents_Removals);
+	OnUnitRemovedFromPlay.Broadcast(Actor, bDied);
+
+	// 블랙보드를 비우면 옵저버가 다시 UnwatchTarget을 부르므로 목록을 떼어낸 뒤 처리
+	TArray<TWeakObjectPtr<AAIController>> Watchers;
+	if (!WatchersByTarget.RemoveAndCopyValue(Actor, Watchers)) return;
+
+	for (const TWeakObjectPtr<AAIController>& WeakWatcher : Watchers)
+	{
+		AAIController* Watcher = WeakWatcher.Get();
+		if (!Watcher) continue;
+
+		if (TargetByWatcher.Remove(Watcher) > 0)
+		{
+			DEC_DWORD_STAT(STAT_UnitEvents_Watchers);
+		}
+
+		UBlackboardComponent* BB = Watcher->GetBlackboardComponent();
+		if (!BB || BB->GetValueAsObject(BB_KEYS::TargetActor) != Actor) continue;
+
+		BB->ClearValue(BB_KEYS::TargetActor);
+		BB->SetValueAsFloat(BB_KEYS::DistanceToTarget, 999999.0f);
+		INC_DWORD_STAT(STAT_UnitEvents_Cleared);
+
+		QueueRetarget(*Watcher);
+	}
+}
+
+void UUnitDeathEventSubsystem::QueueRetarget(AAIController& Watcher)
+{
+	UBehaviorTreeComponent* BTComp = Cast<UBehaviorTreeComponent>(Watcher.GetBrainComponent());
+	if (!BTComp) return;
+
+	// 프레임 예산 스케줄러가 켜져 있으면 예약만 (한 번에 많은 유닛이 같은 대상을 잃어도 스파이크가 없도록)
+	if (UAIWorkSchedulerSubsystem::IsEnabled())
+	{
+		if (UAIWorkSchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UAIWorkSchedulerSubsystem>())
+		{
+			Scheduler->Enqueue(*BTComp, this);
+			return;
+		}
+	}
+
+	ExecuteScheduledWork(*BTComp);
+}
+
+void UUnitDeathEventSubsystem::ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UnitEvents_Retarget);
+
+	AMyAIController* AIC = Cast<AMyAIController>(OwnerComp.GetAIOwner());
+	ABaseUnit* SelfUnit = AIC ? Cast<ABaseUnit>(AIC->GetPawn()) : nullptr;
+	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
+	if (!SelfUnit || SelfUnit->bIsDead || !BB) return;
+
+	// 차례를 기다리는 동안 감지/서비스가 이미 새 타겟을 잡았으면 그대로 둠
+	if (BB->GetValueAsObject(BB_KEYS::TargetActor)) return;
+
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	if (!Grid) return;
+
+	float Distance = 0.f;
+	if (ABaseUnit* NewTarget = Grid->FindNearestEnemy(SelfUnit, AIC->GetSightRadius(), &Distance))
+	{
+		// 감지 경로와 같은 규칙(적대 판정 포함)으로 기록
+		AIC->ProcessSensedActor(NewTarget, true);
+		if (BB->GetValueAsObject(BB_KEYS::TargetActor) == NewTarget)
+		{
+			BB->SetValueAsFloat(BB_KEYS::DistanceToTarget, Distance);
+		}
+	}
+}
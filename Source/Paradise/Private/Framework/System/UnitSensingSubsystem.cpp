@@ -0,0 +1,244 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/UnitSensingSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Framework/InGame/MyAIController.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/MonsterAI.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseSensing"), STATGROUP_ParadiseSensing, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Sense"), STAT_Sensing_Tick, STATGROUP_ParadiseSensing);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sensors"), STAT_Sensing_Sensors, STATGROUP_ParadiseSensing);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targets Sensed / Frame"), STAT_Sensing_Sensed, STATGROUP_ParadiseSensing);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targets Lost / Frame"), STAT_Sensing_Lost, STATGROUP_ParadiseSensing);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Traces Issued / Frame"), STAT_Sensing_Traces, STATGROUP_ParadiseSensing);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Traces Blocked / Frame"), STAT_Sensing_Blocked, STATGROUP_ParadiseSensing);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred (Trace Budget) / Frame"), STAT_Sensing_Deferred, STATGROUP_ParadiseSensing);
+
+static TAutoConsoleVariable<float> CVarSensingInterval(
+	TEXT("paradise.ai.sensing.Interval"),
+	0.25f,
+	TEXT("격자 감지 주기(초). 유닛마다 이 간격으로 적을 다시 찾습니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSensingLineOfSight(
+	TEXT("paradise.ai.sensing.LineOfSight"),
+	1,
+	TEXT("1이면 후보 적을 비동기 라인 트레이스로 시야 확인한 뒤 감지합니다. 0이면 거리만 봅니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSensingMaxTracesPerFrame(
+	TEXT("paradise.ai.sensing.MaxTracesPerFrame"),
+	32,
+	TEXT("프레임당 요청할 수 있는 시야 확인 트레이스 최대 개수. 넘는 센서는 다음 프레임으로 미룹니다."),
+	ECVF_Default);
+
+void UUnitSensingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SightTraceDelegate.BindUObject(this, &UUnitSensingSubsystem::OnSightTraceCompleted);
+}
+
+void UUnitSensingSubsystem::Deinitialize()
+{
+	Sensors.Reset();
+	SensorIndexMap.Reset();
+	PendingTraces.Reset();
+	SightTraceDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+TStatId UUnitSensingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitSensingSubsystem, STATGROUP_Tickables);
+}
+
+void UUnitSensingSubsystem::RegisterSensor(AMyAIController* Controller)
+{
+	if (!IsValid(Controller) || SensorIndexMap.Contains(Controller)) return;
+
+	FUnitSensor& Sensor = Sensors.AddDefaulted_GetRef();
+	Sensor.Controller = Controller;
+	Sensor.Key = Controller;
+
+	// 한꺼번에 스폰된 유닛들이 같은 프레임에 몰리지 않도록 첫 감지 시각을 분산
+	Sensor.NextSenseTime = GetWorld()->GetTimeSeconds() + FMath::FRand() * CVarSensingInterval.GetValueOnGameThread();
+
+	SensorIndexMap.Add(Controller, Sensors.Num() - 1);
+}
+
+void UUnitSensingSubsystem::UnregisterSensor(AMyAIController* Controller)
+{
+	if (const int32* Found = SensorIndexMap.Find(Controller))
+	{
+		RemoveSensorAt(*Found);
+	}
+}
+
+void UUnitSensingSubsystem::RemoveSensorAt(int32 SensorIndex)
+{
+	SensorIndexMap.Remove(Sensors[SensorIndex].Key);
+
+	Sensors.RemoveAtSwap(SensorIndex, 1, EAllowShrinking::No);
+	if (Sensors.IsValidIndex(SensorIndex))
+	{
+		SensorIndexMap.Add(Sensors[SensorIndex].Key, SensorIndex);
+	}
+}
+
+void UUnitSensingSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sensing_Tick);
+
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_Sensing_Sensors, Sensors.Num());
+
+	const int32 NumSensors = Sensors.Num();
+	if (NumSensors == 0) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const bool bLineOfSight = CVarSensingLineOfSight.GetValueOnGameThread() != 0;
+	int32 TracesLeft = CVarSensingMaxTracesPerFrame.GetValueOnGameThread();
+
+	const int32 StartIndex = SenseCursor % NumSensors;
+	int32 FirstDeferred = INDEX_NONE;
+	TArray<int32, TInlineAllocator<8>> InvalidSensors;
+
+	for (int32 Count = 0; Count < NumSensors; ++Count)
+	{
+		const int32 SensorIndex = (StartIndex + Count) % NumSensors;
+		FUnitSensor& Sensor = Sensors[SensorIndex];
+		if (!Sensor.Controller.IsValid())
+		{
+			InvalidSensors.Add(SensorIndex);
+			continue;
+		}
+
+		const EUnitSenseResult Result = SenseOne(Sensor, Now, bLineOfSight, TracesLeft > 0);
+		if (Result == EUnitSenseResult::TraceIssued)
+		{
+			--TracesLeft;
+		}
+		else if (Result == EUnitSenseResult::Deferred && FirstDeferred == INDEX_NONE)
+		{
+			FirstDeferred = SensorIndex;
+		}
+	}
+
+	// 예산 때문에 밀린 센서부터 다음 프레임에 처리
+	SenseCursor = FirstDeferred != INDEX_NONE ? FirstDeferred : 0;
+
+	// 파괴된 컨트롤러 정리 (뒤에서부터 지워야 인덱스가 유지됨)
+	InvalidSensors.Sort(TGreater<int32>());
+	for (const int32 SensorIndex : InvalidSensors)
+	{
+		RemoveSensorAt(SensorIndex);
+	}
+}
+
+EUnitSenseResult UUnitSensingSubsystem::SenseOne(FUnitSensor& Sensor, double Now, bool bLineOfSight, bool bCanTrace)
+{
+	AMyAIController* Controller = Sensor.Controller.Get();
+	if (Sensor.bTracePending || Now < Sensor.NextSenseTime || Controller->IsDormant()) return EUnitSenseResult::Done;
+
+	ABaseUnit* SelfUnit = Cast<ABaseUnit>(Controller->GetPawn());
+	UBlackboardComponent* BB = Controller->GetBlackboardComponent();
+	if (!SelfUnit || SelfUnit->bIsDead || !BB) return EUnitSenseResult::Done;
+
+	const double NextSenseTime = Now + CVarSensingInterval.GetValueOnGameThread();
+
+	// 1. 타겟이 있으면 상실 조건만 확인 (AIPerception의 LoseSightRadius와 동일)
+	if (AActor* CurrentTarget = Cast<AActor>(BB->GetValueAsObject(BB_KEYS::TargetActor)))
+	{
+		const ABaseUnit* CurrentUnit = Cast<ABaseUnit>(CurrentTarget);
+		const bool bLost = CurrentTarget->IsHidden()
+			|| (CurrentUnit && CurrentUnit->bIsDead)
+			|| FVector::DistSquared(SelfUnit->GetActorLocation(), CurrentTarget->GetActorLocation()) > FMath::Square(Controller->GetLoseSightRadius());
+
+		if (bLost)
+		{
+			Controller->ProcessSensedActor(CurrentTarget, false);
+			INC_DWORD_STAT(STAT_Sensing_Lost);
+		}
+		Sensor.NextSenseTime = NextSenseTime;
+		return EUnitSenseResult::Done;
+	}
+
+	// 2. 시야 반경 안의 가장 가까운 적 (적 진영 버킷만 조회)
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	ABaseUnit* Candidate = Grid ? Grid->FindNearestEnemy(SelfUnit, Controller->GetSightRadius()) : nullptr;
+	if (!Candidate)
+	{
+		Sensor.NextSenseTime = NextSenseTime;
+		return EUnitSenseResult::Done;
+	}
+
+	if (!bLineOfSight)
+	{
+		Controller->ProcessSensedActor(Candidate, true);
+		INC_DWORD_STAT(STAT_Sensing_Sensed);
+		Sensor.NextSenseTime = NextSenseTime;
+		return EUnitSenseResult::Done;
+	}
+
+	if (!bCanTrace)
+	{
+		INC_DWORD_STAT(STAT_Sensing_Deferred);
+		return EUnitSenseResult::Deferred;
+	}
+
+	// 3. 시야 확인 (결과는 다음 프레임 OnSightTraceCompleted에서)
+	FVector EyeLocation;
+	FRotator EyeRotation;
+	SelfUnit->GetActorEyesViewPoint(EyeLocation, EyeRotation);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(UnitSensingSight), false, SelfUnit);
+	Params.AddIgnoredActor(Candidate);
+
+	const uint32 TraceId = NextTraceId++;
+	PendingTraces.Add(TraceId, { Controller, Candidate });
+
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, EyeLocation, Candidate->GetActorLocation(), ECC_Visibility,
+		Params, FCollisionResponseParams::DefaultResponseParam, &SightTraceDelegate, TraceId);
+	INC_DWORD_STAT(STAT_Sensing_Traces);
+
+	Sensor.bTracePending = true;
+	Sensor.NextSenseTime = NextSenseTime;
+	return EUnitSenseResult::TraceIssued;
+}
+
+void UUnitSensingSubsystem::OnSightTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FPendingSightTrace Pending;
+	if (!PendingTraces.RemoveAndCopyValue(Datum.UserData, Pending)) return;
+
+	AMyAIController* Controller = Pending.Controller.Get();
+	if (!Controller) return;
+
+	if (const int32* SensorIndex = SensorIndexMap.Find(Controller))
+	{
+		Sensors[*SensorIndex].bTracePending = false;
+	}
+
+	ABaseUnit* Target = Pending.Target.Get();
+	if (!Target || Target->bIsDead || Target->IsHidden() || Controller->IsDormant()) return;
+
+	const bool bBlocked = Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	if (bBlocked)
+	{
+		INC_DWORD_STAT(STAT_Sensing_Blocked);
+		return;
+	}
+
+	Controller->ProcessSensedActor(Target, true);
+	INC_DWORD_STAT(STAT_Sensing_Sensed);
+}
@@ -0,0 +1,315 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/ParadiseFactionTable.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseGrid"), STATGROUP_ParadiseGrid, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Tick (Update Cells)"), STAT_Grid_Tick, STATGROUP_ParadiseGrid);
+DECLARE_CYCLE_STAT(TEXT("QueryRadius"), STAT_Grid_QueryRadius, STATGROUP_ParadiseGrid);
+DECLARE_CYCLE_STAT(TEXT("QueryKNearest"), STAT_Grid_QueryKNearest, STATGROUP_ParadiseGrid);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queries / Frame"), STAT_Grid_Queries, STATGROUP_ParadiseGrid);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cell Moves / Frame"), STAT_Grid_CellMoves, STATGROUP_ParadiseGrid);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Registered Units"), STAT_Grid_Units, STATGROUP_ParadiseGrid);
+
+static TAutoConsoleVariable<float> CVarGridCellSize(
+	TEXT("paradise.grid.CellSize"),
+	500.0f,
+	TEXT("유닛 공간 격자의 셀 크기(cm). 주로 쓰는 탐색 반경과 비슷하게 맞추는 것이 좋습니다. (월드 시작 시 적용)"),
+	ECVF_Default);
+
+void UUnitSpatialGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(CVarGridCellSize.GetValueOnGameThread(), 100.f);
+}
+
+void UUnitSpatialGridSubsystem::Deinitialize()
+{
+	Entries.Reset();
+	EntryIndexMap.Reset();
+	FactionCells.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UUnitSpatialGridSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitSpatialGridSubsystem, STATGROUP_Tickables);
+}
+
+void UUnitSpatialGridSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Grid_Tick);
+
+	Super::Tick(DeltaTime);
+
+	// 뒤에서부터 돌면 RemoveEntryAt으로 당겨온 항목은 이미 갱신된 항목입니다.
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		const ABaseUnit* Unit = Entries[Index].Unit.Get();
+		if (!Unit)
+		{
+			// 해제 없이 파괴된 유닛 정리
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		FUnitGridEntry& Entry = Entries[Index];
+		Entry.Location = Unit->GetActorLocation();
+
+		const FIntPoint NewCell = ToCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Index);
+			Entry.Cell = NewCell;
+			AddToCell(Index);
+			INC_DWORD_STAT(STAT_Grid_CellMoves);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_Grid_Units, Entries.Num());
+}
+
+#pragma region 등록
+void UUnitSpatialGridSubsystem::RegisterUnit(ABaseUnit* Unit)
+{
+	if (!IsValid(Unit) || EntryIndexMap.Contains(Unit)) return;
+
+	const int32 EntryIndex = Entries.AddDefaulted();
+	FUnitGridEntry& Entry = Entries[EntryIndex];
+	Entry.Unit = Unit;
+	Entry.Key = Unit;
+	Entry.Location = Unit->GetActorLocation();
+	Entry.Cell = ToCell(Entry.Location);
+	Entry.FactionIndex = ResolveFaction(Unit);
+
+	EntryIndexMap.Add(Unit, EntryIndex);
+	AddToCell(EntryIndex);
+}
+
+void UUnitSpatialGridSubsystem::UnregisterUnit(ABaseUnit* Unit)
+{
+	if (const int32* Found = EntryIndexMap.Find(Unit))
+	{
+		RemoveEntryAt(*Found);
+	}
+}
+
+void UUnitSpatialGridSubsystem::UpdateUnitFaction(ABaseUnit* Unit)
+{
+	const int32* Found = EntryIndexMap.Find(Unit);
+	if (!Found)
+	{
+		RegisterUnit(Unit);
+		return;
+	}
+
+	const int32 EntryIndex = *Found;
+	const int32 NewFactionIndex = ResolveFaction(Unit);
+	if (Entries[EntryIndex].FactionIndex == NewFactionIndex) return;
+
+	RemoveFromCell(EntryIndex);
+	Entries[EntryIndex].FactionIndex = NewFactionIndex;
+	AddToCell(EntryIndex);
+}
+
+int32 UUnitSpatialGridSubsystem::ResolveFaction(const ABaseUnit* Unit)
+{
+	uint8 FactionId = Unit->FactionId;
+	if (FactionId == FParadiseFactionTable::InvalidId)
+	{
+		FactionId = FParadiseFactionTable::Get().FindOrAddFaction(Unit->FactionTag);
+	}
+
+	if (FactionCells.Num() <= FactionId)
+	{
+		FactionCells.SetNum(FactionId + 1);
+	}
+	return FactionId;
+}
+
+FIntPoint UUnitSpatialGridSubsystem::ToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UUnitSpatialGridSubsystem::AddToCell(int32 EntryIndex)
+{
+	const FUnitGridEntry& Entry = Entries[EntryIndex];
+	FactionCells[Entry.FactionIndex].FindOrAdd(Entry.Cell).Add(EntryIndex);
+}
+
+void UUnitSpatialGridSubsystem::RemoveFromCell(int32 EntryIndex)
+{
+	const FUnitGridEntry& Entry = Entries[EntryIndex];
+	TMap<FIntPoint, TArray<int32>>& Cells = FactionCells[Entry.FactionIndex];
+	if (TArray<int32>* Bucket = Cells.Find(Entry.Cell))
+	{
+		Bucket->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+}
+
+void UUnitSpatialGridSubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+	RemoveFromCell(EntryIndex);
+	EntryIndexMap.Remove(Entries[EntryIndex].Key);
+
+	// 마지막 항목을 빈자리로 옮기고 버킷/맵의 인덱스도 고쳐줍니다.
+	const int32 LastIndex = Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		RemoveFromCell(LastIndex);
+		Entries[EntryIndex] = MoveTemp(Entries[LastIndex]);
+		EntryIndexMap.Add(Entries[EntryIndex].Key, EntryIndex);
+		AddToCell(EntryIndex);
+	}
+	Entries.Pop(EAllowShrinking::No);
+}
+#pragma endregion 등록
+
+#pragma region 쿼리
+uint32 UUnitSpatialGridSubsystem::GetHostileFactions(const ABaseUnit* Self) const
+{
+	return FParadiseFactionTable::Get().GetHostileMask(Self->FactionId);
+}
+
+template<typename FunctorType>
+void UUnitSpatialGridSubsystem::ForEachInCell(int32 FactionIndex, const FIntPoint& Cell, FunctorType&& Func) const
+{
+	if (const TArray<int32>* Bucket = FactionCells[FactionIndex].Find(Cell))
+	{
+		for (const int32 EntryIndex : *Bucket)
+		{
+			Func(Entries[EntryIndex]);
+		}
+	}
+}
+
+void UUnitSpatialGridSubsystem::QueryRadius(const FVector& Center, float Radius, TArray<ABaseUnit*>& OutUnits, const ABaseUnit* EnemiesOf) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Grid_QueryRadius);
+	INC_DWORD_STAT(STAT_Grid_Queries);
+
+	OutUnits.Reset();
+
+	const uint32 Hostile = EnemiesOf ? GetHostileFactions(EnemiesOf) : 0u;
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius));
+	const float RadiusSq = FMath::Square(Radius);
+
+	for (int32 FactionIndex = 0; FactionIndex < FactionCells.Num(); ++FactionIndex)
+	{
+		if (EnemiesOf && !(Hostile & (1u << FactionIndex))) continue;
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				ForEachInCell(FactionIndex, FIntPoint(X, Y), [&](const FUnitGridEntry& Entry)
+				{
+					ABaseUnit* Unit = Entry.Unit.Get();
+					if (!Unit || Unit == EnemiesOf || (EnemiesOf && Unit->bIsDead)) return;
+					if (FVector::DistSquared(Center, Entry.Location) > RadiusSq) return;
+
+					OutUnits.Add(Unit);
+				});
+			}
+		}
+	}
+}
+
+void UUnitSpatialGridSubsystem::QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<FUnitGridQueryResult>& OutResults, const ABaseUnit* EnemiesOf) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Grid_QueryKNearest);
+	INC_DWORD_STAT(STAT_Grid_Queries);
+
+	OutResults.Reset();
+	if (K <= 0 || MaxRadius <= 0.f) return;
+
+	const uint32 Hostile = EnemiesOf ? GetHostileFactions(EnemiesOf) : 0u;
+	const FIntPoint CenterCell = ToCell(Center);
+	const int32 MaxRing = FMath::CeilToInt32(MaxRadius / CellSize);
+	const float MaxRadiusSq = FMath::Square(MaxRadius);
+
+	auto VisitCell = [&](const FIntPoint& Cell)
+	{
+		for (int32 FactionIndex = 0; FactionIndex < FactionCells.Num(); ++FactionIndex)
+		{
+			if (EnemiesOf && !(Hostile & (1u << FactionIndex))) continue;
+
+			ForEachInCell(FactionIndex, Cell, [&](const FUnitGridEntry& Entry)
+			{
+				ABaseUnit* Unit = Entry.Unit.Get();
+				if (!Unit || Unit == EnemiesOf || (EnemiesOf && Unit->bIsDead)) return;
+
+				const float DistSq = FVector::DistSquared(Center, Entry.Location);
+				if (DistSq > MaxRadiusSq) return;
+
+				OutResults.Add({ Unit, DistSq });
+			});
+		}
+	};
+
+	auto ByDistance = [](const FUnitGridQueryResult& A, const FUnitGridQueryResult& B) { return A.DistSq < B.DistSq; };
+
+	// 중심 셀부터 한 고리씩 넓혀가며 탐색
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		if (Ring == 0)
+		{
+			VisitCell(CenterCell);
+		}
+		else
+		{
+			for (int32 D = -Ring; D <= Ring; ++D)
+			{
+				VisitCell(CenterCell + FIntPoint(D, -Ring));
+				VisitCell(CenterCell + FIntPoint(D, Ring));
+			}
+			for (int32 D = -Ring + 1; D <= Ring - 1; ++D)
+			{
+				VisitCell(CenterCell + FIntPoint(-Ring, D));
+				VisitCell(CenterCell + FIntPoint(Ring, D));
+			}
+		}
+
+		// 다음 고리의 유닛은 최소 Ring * CellSize 이상 떨어져 있으므로, K번째가 그보다 가까우면 확정
+		if (OutResults.Num() >= K)
+		{
+			OutResults.Sort(ByDistance);
+			if (OutResults[K - 1].DistSq <= FMath::Square(Ring * CellSize)) break;
+		}
+	}
+
+	OutResults.Sort(ByDistance);
+	if (OutResults.Num() > K)
+	{
+		OutResults.SetNum(K, EAllowShrinking::No);
+	}
+}
+
+ABaseUnit* UUnitSpatialGridSubsystem::FindNearestEnemy(const ABaseUnit* Self, float MaxRadius, float* OutDistance) const
+{
+	if (!Self) return nullptr;
+
+	TArray<FUnitGridQueryResult> Nearest;
+	QueryKNearest(Self->GetActorLocation(), 1, MaxRadius, Nearest, Self);
+	if (Nearest.Num() == 0) return nullptr;
+
+	if (OutDistance)
+	{
+		*OutDistance = FMath::Sqrt(Nearest[0].DistSq);
+	}
+	return Nearest[0].Unit;
+}
+#pragma endregion 쿼리
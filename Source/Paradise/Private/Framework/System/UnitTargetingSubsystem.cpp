@@ -0,0 +1,207 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Framework/System/UnitTargetingSubsystem.h"
+#include "Framework/System/UnitSpatialGridSubsystem.h"
+#include "Characters/AIUnit/BaseUnit.h"
+#include "AI/ParadiseFactionTable.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_STATS_GROUP(TEXT("ParadiseTargeting"), STATGROUP_ParadiseTargeting, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Snapshot"), STAT_Targeting_Snapshot, STATGROUP_ParadiseTargeting);
+DECLARE_CYCLE_STAT(TEXT("Solve"), STAT_Targeting_Solve, STATGROUP_ParadiseTargeting);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Units Solved"), STAT_Targeting_Units, STATGROUP_ParadiseTargeting);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Table Misses / Frame"), STAT_Targeting_Misses, STATGROUP_ParadiseTargeting);
+
+static TAutoConsoleVariable<int32> CVarTargetingEnable(
+	TEXT("paradise.ai.targeting.Enable"),
+	1,
+	TEXT("1이면 프레임당 한 번 최근접 적을 일괄 계산합니다. 0이면 BT 서비스가 그리드를 직접 조회합니다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTargetingParallel(
+	TEXT("paradise.ai.targeting.Parallel"),
+	1,
+	TEXT("1이면 일괄 계산을 ParallelFor로 나눠 실행합니다."),
+	ECVF_Default);
+
+static FAutoConsoleCommand GTargetingBenchCommand(
+	TEXT("paradise.ai.targeting.bench"),
+	TEXT("최근접 적 탐색을 전수 검사/단일 스레드/병렬로 비교합니다. 사용법: paradise.ai.targeting.bench [반복 횟수=20] [유닛 수...=100 500 2000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic([](const TArray<FString>& Args)
+	{
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 20;
+
+		TArray<int32> UnitCounts;
+		for (int32 Index = 1; Index < Args.Num(); ++Index)
+		{
+			UnitCounts.Add(FMath::Max(FCString::Atoi(*Args[Index]), 1));
+		}
+		if (UnitCounts.Num() == 0)
+		{
+			UnitCounts = { 100, 500, 2000 };
+		}
+
+		UUnitTargetingSubsystem::RunBenchmark(UnitCounts, Iterations);
+	}));
+
+void UUnitTargetingSubsystem::Deinitialize()
+{
+	Snapshot.Reset();
+	Results = FUnitTargetingResults();
+	SlotUnits.Reset();
+	UnitSlots.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UUnitTargetingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUnitTargetingSubsystem, STATGROUP_Tickables);
+}
+
+void UUnitTargetingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 요청한 서비스가 없으면(반경 0) 계산할 필요 없음
+	if (!CVarTargetingEnable.GetValueOnGameThread() || SearchRadius <= 0.f)
+	{
+		SlotUnits.Reset();
+		UnitSlots.Reset();
+		return;
+	}
+
+	SolveFrame();
+}
+
+void UUnitTargetingSubsystem::RequestSearchRadius(float Radius)
+{
+	SearchRadius = FMath::Max(SearchRadius, Radius);
+}
+
+void UUnitTargetingSubsystem::SolveFrame()
+{
+	const UUnitSpatialGridSubsystem* Grid = GetWorld()->GetSubsystem<UUnitSpatialGridSubsystem>();
+	if (!Grid) return;
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Targeting_Snapshot);
+
+		const TArray<FUnitGridEntry>& Entries = Grid->GetEntries();
+
+		Snapshot.Reset(Entries.Num());
+		SlotUnits.Reset(Entries.Num());
+		UnitSlots.Reset();
+
+		// 진영 간 적대 관계 (IsEnemy와 같은 진영 테이블 마스크를 그대로 복사)
+		const FParadiseFactionTable& FactionTable = FParadiseFactionTable::Get();
+		const int32 NumFactions = FMath::Min(Grid->GetNumFactions(), FUnitTargetingSnapshot::MaxFactions);
+		Snapshot.HostileMask.SetNumUninitialized(NumFactions);
+		for (int32 A = 0; A < NumFactions; ++A)
+		{
+			Snapshot.HostileMask[A] = FactionTable.GetHostileMask(static_cast<uint8>(A));
+		}
+
+		for (const FUnitGridEntry& Entry : Entries)
+		{
+			ABaseUnit* Unit = Entry.Unit.Get();
+			if (!Unit || Unit->bIsDead || Entry.FactionIndex >= NumFactions) continue;
+
+			const int32 Slot = Snapshot.Add(Unit->GetActorLocation(), Entry.FactionIndex);
+			SlotUnits.Add(Unit);
+			UnitSlots.Add(Unit, Slot);
+		}
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Targeting_Solve);
+		FUnitTargetingSolver::Solve(Snapshot, SearchRadius, Results, CVarTargetingParallel.GetValueOnGameThread() != 0);
+	}
+
+	SET_DWORD_STAT(STAT_Targeting_Units, Snapshot.Num());
+}
+
+bool UUnitTargetingSubsystem::GetNearestEnemy(const ABaseUnit* Unit, ABaseUnit*& OutTarget, float& OutDistance) const
+{
+	OutTarget = nullptr;
+	OutDistance = MAX_flt;
+
+	const int32* Slot = UnitSlots.Find(Unit);
+	if (!Slot)
+	{
+		INC_DWORD_STAT(STAT_Targeting_Misses);
+		return false;
+	}
+
+	const int32 TargetSlot = Results.TargetSlot[*Slot];
+	if (TargetSlot == INDEX_NONE) return true;
+
+	// 계산 이후 사망/풀 반환된 적이면 직접 탐색하도록 미스 처리
+	ABaseUnit* Target = SlotUnits[TargetSlot].Get();
+	if (!Target || Target->bIsDead || Target->IsHidden())
+	{
+		INC_DWORD_STAT(STAT_Targeting_Misses);
+		return false;
+	}
+
+	OutTarget = Target;
+	OutDistance = Results.Distance[*Slot];
+	return true;
+}
+
+void UUnitTargetingSubsystem::RunBenchmark(const TArray<int32>& UnitCounts, int32 Iterations)
+{
+	constexpr float BenchRadius = 1000.f;
+
+	UE_LOG(LogTemp, Log, TEXT("===== [Targeting] 최근접 적 벤치마크 (반경 %.0f, 반복 %d회) ====="), BenchRadius, Iterations);
+
+	for (const int32 NumUnits : UnitCounts)
+	{
+		// 고정 시드로 두 진영을 무작위 배치 (유닛당 면적이 일정하도록 맵 크기 조절)
+		FRandomStream Random(1234);
+		const float HalfExtent = FMath::Sqrt(static_cast<float>(NumUnits)) * 150.f;
+
+		FUnitTargetingSnapshot BenchSnapshot;
+		BenchSnapshot.Reset(NumUnits);
+		BenchSnapshot.HostileMask = { 1u << 1, 1u << 0 };
+		for (int32 Index = 0; Index < NumUnits; ++Index)
+		{
+			const FVector Location(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 0.f);
+			BenchSnapshot.Add(Location, Index & 1);
+		}
+
+		FUnitTargetingResults BruteResults;
+		FUnitTargetingResults SingleResults;
+		FUnitTargetingResults ParallelResults;
+
+		auto Measure = [Iterations](TFunctionRef<void()> Body)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iter = 0; Iter < Iterations; ++Iter)
+			{
+				Body();
+			}
+			return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) / Iterations;
+		};
+
+		const double BruteMs = Measure([&]() { FUnitTargetingSolver::SolveBruteForce(BenchSnapshot, BenchRadius, BruteResults); });
+		const double SingleMs = Measure([&]() { FUnitTargetingSolver::Solve(BenchSnapshot, BenchRadius, SingleResults, false); });
+		const double ParallelMs = Measure([&]() { FUnitTargetingSolver::Solve(BenchSnapshot, BenchRadius, ParallelResults, true); });
+
+		// 같은 거리의 적이 여럿일 수 있으므로 거리로 검증
+		int32 Mismatches = 0;
+		for (int32 Index = 0; Index < NumUnits; ++Index)
+		{
+			if (!FMath::IsNearlyEqual(BruteResults.Distance[Index], ParallelResults.Distance[Index], 0.5f))
+			{
+				++Mismatches;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("📊 [Targeting] 유닛 %5d | 전수 검사 %8.3f ms | 셀 정렬(단일) %7.3f ms | 셀 정렬(병렬) %7.3f ms | x%.1f | 불일치 %d"),
+			NumUnits, BruteMs, SingleMs, ParallelMs, ParallelMs > 0.0 ? BruteMs / ParallelMs : 0.0, Mismatches);
+	}
+}
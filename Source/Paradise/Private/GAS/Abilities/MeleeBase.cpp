@@ -2,13 +2,15 @@
 
 
 #include "GAS/Abilities/MeleeBase.h"
+#include "GAS/System/ParadiseGameplayTags.h"
+#include "AbilitySystemBlueprintLibrary.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
 
 UMeleeBase::UMeleeBase()
 {
 	// 기본적으로 감지할 태그 설정
-	HitEventTag = FGameplayTag::RequestGameplayTag(FName("Event.Montage.Hit"));
+	HitEventTag = FParadiseGameplayTags::Get().Event_Montage_Hit;
 }
 
 void UMeleeBase::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
@@ -69,9 +71,13 @@ void UMeleeBase::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const
 
 void UMeleeBase::OnGameplayEventReceived(FGameplayEventData Payload)
 {
-	// 1. 맞은 대상(Target) 확인
-	AActor* TargetActor = const_cast<AActor*>(Payload.Target.Get());
-	if (!TargetActor) return;
+	// 1. 맞은 대상들 확인 (판정 컴포넌트는 한 프레임 대상들을 TargetData로 묶어 보냄, 없으면 Target 하나)
+	TArray<AActor*> TargetActors = UAbilitySystemBlueprintLibrary::GetAllActorsFromTargetData(Payload.TargetData);
+	if (TargetActors.IsEmpty() && Payload.Target)
+	{
+		TargetActors.Add(const_cast<AActor*>(Payload.Target.Get()));
+	}
+	if (TargetActors.IsEmpty()) return;
 
 	// 2. 데이터 다시 조회 (Base 클래스에서 캐싱해주므로 비용 걱정 없음)
 	FCombatActionData CombatData = GetCombatDataFromActor();
@@ -83,7 +89,7 @@ void UMeleeBase::OnGameplayEventReceived(FGameplayEventData Payload)
 		return;
 	}
 
-	// 3. GE 스펙 생성 (Make Spec)
+	// 3. GE 스펙 생성 (Make Spec) - 대상이 여럿이어도 스펙은 한 번만 만듦
 	// BaseGameplayAbility에 구현된 Helper 함수 사용
 	FGameplayEffectSpecHandle SpecHandle = MakeSpecHandle(CombatData.DamageEffectClass, GetAbilityLevel());
 
@@ -93,12 +99,15 @@ void UMeleeBase::OnGameplayEventReceived(FGameplayEventData Payload)
 		// 스킬 계수(1.5 등)를 "Data.Damage.Multiplier" 태그로 포장해서 보냅니다.
 		// 이 값은 ExecCalcCombat(계산식)에서 꺼내 씁니다.
 		SpecHandle.Data->SetSetByCallerMagnitude(
-			FGameplayTag::RequestGameplayTag(FName("Data.Damage.Multiplier")),
+			FParadiseGameplayTags::Get().Data_Damage_Multiplier,
 			CombatData.DamageMultiplier
 		);
 
-		// 5. 적용 (Apply)
-		ApplySpecHandleToTarget(TargetActor, SpecHandle);
+		// 5. 적용 (Apply) - 치명타는 적용할 때마다 계산식에서 따로 굴림
+		for (AActor* TargetActor : TargetActors)
+		{
+			ApplySpecHandleToTarget(TargetActor, SpecHandle);
+		}
 	}
 }
 
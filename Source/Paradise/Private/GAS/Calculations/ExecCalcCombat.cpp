@@ -3,7 +3,10 @@
 
 #include "GAS/Calculations/ExecCalcCombat.h"
 #include "GAS/Attributes/BaseAttributeSet.h"
+#include "GAS/Calculations/CombatFormula.h"
 #include "GAS/System/ParadiseGameplayTags.h"
+#include "Framework/System/DamagePopupSubsystem.h"
+#include "Framework/System/BattleRandomSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffectTypes.h"
 
@@ -72,38 +75,40 @@ void UExecCalcCombat::Execute_Implementation(const FGameplayEffectCustomExecutio
 	// 공격력 가져오기
 	float AttackPower = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().AttackPowerDef, EvalParams, AttackPower);
+
+	// ASC가 없는 공격자(AI 유닛 투사체 등)는 공격력을 SetByCaller로 직접 전달
+	AttackPower += Spec.GetSetByCallerMagnitude(
+		FParadiseGameplayTags::Get().Data_Damage_Base,
+		false,
+		0.0f
+	);
 	AttackPower = FMath::Max(AttackPower, 0.f); // 음수 방지
 
 	float DamageMultiplier = Spec.GetSetByCallerMagnitude(
-		FGameplayTag::RequestGameplayTag(FName("Data.Damage.Multiplier")),
+		FParadiseGameplayTags::Get().Data_Damage_Multiplier,
 		false,
 		1.0f // 못 찾으면 기본값 1.0 (평타)
 	);
 
-	// 현재 데미지 누적
-	float CurrentDamage = AttackPower * DamageMultiplier;
-
 	// =========================================================
 	//  치명타 계산 (Critical Hit)
 	// =========================================================
 
 	float CritRate = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CritRateDef, EvalParams, CritRate);
-	CritRate = FMath::Clamp(CritRate, 0.f, 1.f); // 0~1 사이 안전장치
 
-	// 랜덤 확률 체크 (0.0 ~ 1.0)
-	const bool bIsCritical = FMath::RandRange(0.f, 1.f) <= CritRate;
+	// 랜덤 확률 체크 (0.0 ~ 1.0) - 전투 시드 스트림 사용 (월드를 못 찾으면 전역 난수)
+	FRandomStream* CritStream = UBattleRandomSubsystem::FindStream(SourceASC ? SourceASC : TargetASC, EBattleRandomStream::Crit);
+	const float CritRoll = CritStream ? CritStream->GetFraction() : FMath::FRand();
+	const bool bIsCritical = ParadiseCombat::RollCritical(CritRate, CritRoll);
 
+	float CritDamage = 1.f;
 	if (bIsCritical)
 	{
-		float CritDamage = 0.f;
 		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CritDamageDef, EvalParams, CritDamage);
-		CritDamage = FMath::Max(CritDamage, 1.0f); // 최소 1배수 보장
-
-		CurrentDamage *= CritDamage; // 배율 적용
 
 		// 디버그 로그
-		// UE_LOG(LogTemp, Warning, TEXT("CRITICAL HIT! Damage: %f"), CurrentDamage);
+		// UE_LOG(LogTemp, Warning, TEXT("CRITICAL HIT! CritDamage: %f"), CritDamage);
 	}
 
 
@@ -113,13 +118,9 @@ void UExecCalcCombat::Execute_Implementation(const FGameplayEffectCustomExecutio
 
 	float Defense = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().DefenseDef, EvalParams, Defense);
-	Defense = FMath::Max(Defense, 0.f);
-
-	// 비율 감소
-	CurrentDamage *= (100.f / (100.f + Defense));
 
-	// 최소 데미지 보장 (방어력이 높아도 최소 1은 들어감)
-	CurrentDamage = FMath::Max(CurrentDamage, 1.0f);
+	// 공식은 AI 유닛 데미지 큐와 공용 (CombatFormula.h)
+	const float CurrentDamage = ParadiseCombat::ComputeDamage(AttackPower, DamageMultiplier, Defense, bIsCritical, CritDamage);
 
 
 	// =========================================================
@@ -136,5 +137,13 @@ void UExecCalcCombat::Execute_Implementation(const FGameplayEffectCustomExecutio
 				CurrentDamage
 			)
 		);
+
+		// 데미지 숫자 표시 (치명타 여부는 여기서만 알 수 있으므로 계산 시점에 전달)
+		AActor* TargetAvatar = TargetASC ? TargetASC->GetAvatarActor() : nullptr;
+		UWorld* World = TargetAvatar ? TargetAvatar->GetWorld() : nullptr;
+		if (UDamagePopupSubsystem* PopupSubsystem = World ? World->GetSubsystem<UDamagePopupSubsystem>() : nullptr)
+		{
+			PopupSubsystem->AddDamagePopup(TargetAvatar, CurrentDamage, bIsCritical);
+		}
 	}
 }
@@ -2,9 +2,8 @@
 
 
 #include "GAS/Cue/CueNotifyCombat.h"
-#include "Kismet/GameplayStatics.h"
-#include "NiagaraFunctionLibrary.h"
 #include "Data/Assets/FXDataAsset.h"
+#include "Framework/System/CombatFXSubsystem.h"
 
 bool UCueNotifyCombat::OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters) const
 {
@@ -13,45 +12,14 @@ bool UCueNotifyCombat::OnExecute_Implementation(AActor* MyTarget, const FGamepla
         return false;
     }
 
-    // 2. 전달받은 태그 (예: Effect.Hit.Sword)
-    FGameplayTag RequestTag = Parameters.OriginalTag;
-
-    // 3. 데이터 에셋에서 구조체 검색
-    FCombatFXSet* FoundFX = FXDataAsset->FindEffect(RequestTag);
-
-    // 4. 찾았다면 재생!
-    if (FoundFX)
+    UWorld* World = MyTarget ? MyTarget->GetWorld() : GetWorld();
+    UCombatFXSubsystem* FXSubsystem = World ? World->GetSubsystem<UCombatFXSubsystem>() : nullptr;
+    if (!FXSubsystem)
     {
-        FVector SpawnLocation = Parameters.Location; // HitResult 위치
-
-        // (A) 나이아가라 재생 (동기 로드)
-        if (!FoundFX->VisualEffect.IsNull())
-        {
-            UNiagaraSystem* VFX = FoundFX->VisualEffect.LoadSynchronous();
-            if (VFX)
-            {
-                UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-                    GetWorld(),
-                    VFX,
-                    SpawnLocation + FoundFX->LocationOffset,
-                    FRotator::ZeroRotator,
-                    FoundFX->Scale
-                );
-            }
-        }
-
-        // (B) 사운드 재생 (동기 로드)
-        if (!FoundFX->SoundEffect.IsNull())
-        {
-            USoundBase* SFX = FoundFX->SoundEffect.LoadSynchronous();
-            if (SFX)
-            {
-                UGameplayStatics::PlaySoundAtLocation(GetWorld(), SFX, SpawnLocation);
-            }
-        }
-
-        return true;
+        return false;
     }
 
-    return false;
+    // 전달받은 태그 (예: Effect.Hit.Sword)로 재생 요청
+    // 로드/풀링/동시 재생 제한은 서브시스템에서 처리 (동기 로드 없음)
+    return FXSubsystem->PlayCombatFX(FXDataAsset, Parameters.OriginalTag, Parameters.Location);
 }
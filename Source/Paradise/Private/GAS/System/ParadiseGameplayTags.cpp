@@ -2,7 +2,39 @@
 
 
 #include "GAS/System/ParadiseGameplayTags.h"
+#include "GameplayTagsManager.h"
+
+FParadiseGameplayTags FParadiseGameplayTags::GameplayTags;
 
 void FParadiseGameplayTags::InitializeNativeGameplayTags()
 {
+	if (GameplayTags.bInitialized) return;
+	GameplayTags.bInitialized = true;
+
+	UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+
+	// [메타 / 데이터]
+	GameplayTags.Data_Damage_Base = Manager.AddNativeGameplayTag(FName("Data.Damage.Base"), TEXT("공격자 ASC가 없을 때 전달하는 공격력"));
+	GameplayTags.Data_Damage_Multiplier = Manager.AddNativeGameplayTag(FName("Data.Damage.Multiplier"), TEXT("데미지 계산용 배율"));
+
+	// [이벤트]
+	GameplayTags.Event_Montage_Hit = Manager.AddNativeGameplayTag(FName("Event.Montage.Hit"), TEXT("근접 공격 타격 판정 (MeleeBase가 대기)"));
+
+	// [진영]
+	GameplayTags.Unit_Faction_Enemy = Manager.AddNativeGameplayTag(FName("Unit.Faction.Enemy"), TEXT("적"));
+	GameplayTags.Unit_Faction_Neutral = Manager.AddNativeGameplayTag(FName("Unit.Faction.Neutral"), TEXT("중립 (아무와도 적대하지 않음)"));
+	GameplayTags.Unit_Faction_Friendly = Manager.AddNativeGameplayTag(FName("Unit.Faction.Friendly"), TEXT("아군 (하위 진영끼리는 기본적으로 동맹)"));
+	GameplayTags.Unit_Faction_Friendly_Player = Manager.AddNativeGameplayTag(FName("Unit.Faction.Friendly.Player"), TEXT("플레이어"));
+	GameplayTags.Unit_Faction_Friendly_Familiar = Manager.AddNativeGameplayTag(FName("Unit.Faction.Friendly.Familiar"), TEXT("패밀리어"));
+
+	// [등급]
+	GameplayTags.Unit_Rank_Normal = Manager.AddNativeGameplayTag(FName("Unit.Rank.Normal"), TEXT("일반 유닛"));
+	GameplayTags.Unit_Rank_S = Manager.AddNativeGameplayTag(FName("Unit.Rank.S"), TEXT("S 등급"));
+	GameplayTags.Unit_Rank_A = Manager.AddNativeGameplayTag(FName("Unit.Rank.A"), TEXT("A 등급"));
+
+	// [아이템 / 방어구 부위]
+	GameplayTags.Item_Type_Armor_Helmet = Manager.AddNativeGameplayTag(FName("Item.Type.Armor.Helmet"), TEXT("투구"));
+	GameplayTags.Item_Type_Armor_Chest = Manager.AddNativeGameplayTag(FName("Item.Type.Armor.Chest"), TEXT("갑옷"));
+	GameplayTags.Item_Type_Armor_Gloves = Manager.AddNativeGameplayTag(FName("Item.Type.Armor.Gloves"), TEXT("장갑"));
+	GameplayTags.Item_Type_Armor_Boots = Manager.AddNativeGameplayTag(FName("Item.Type.Armor.Boots"), TEXT("신발"));
 }
@@ -4,6 +4,7 @@
 #include "Characters/AIUnit/BaseUnit.h"
 #include "Framework/System/ObjectPoolSubsystem.h"
 #include "AIController.h"
+#include "Framework/InGame/MyAIController.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BrainComponent.h"
 #include "Data/Structs/UnitStructs.h"
@@ -38,7 +39,16 @@ void AFamiliarSpawner::SpawnFamiliarBySlot(int32 SlotIndex)
 			AAIController* AIC = Cast<AAIController>(NewUnit->GetController());
 			if (!AIC) { NewUnit->SpawnDefaultController(); AIC = Cast<AAIController>(NewUnit->GetController()); }
 
-			if (AIC)
+			// 풀에서 휴면 중인 컨트롤러는 BT를 재생성하지 않고 재시작만 합니다.
+			if (AMyAIController* MyAIC = Cast<AMyAIController>(AIC))
+			{
+				if (!AssetData->BehaviorTree.IsNull())
+				{
+					MyAIC->SetUseAIPerception(AssetData->bUseAIPerception);
+					MyAIC->StartUnitBehavior(AssetData->BehaviorTree.LoadSynchronous(), StatData);
+				}
+			}
+			else if (AIC)
 			{
 				AIC->Possess(NewUnit);
 				if (!AssetData->BehaviorTree.IsNull())
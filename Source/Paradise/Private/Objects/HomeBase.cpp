@@ -3,6 +3,8 @@
 #include "Objects/HomeBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Framework/System/FlowFieldSubsystem.h"
+#include "Framework/System/UnitDeathEventSubsystem.h"
 
 AHomeBase::AHomeBase()
 {
@@ -30,6 +32,12 @@ void AHomeBase::BeginPlay()
 		Capsule->SetEnableGravity(false);
 		Capsule->SetMobility(EComponentMobility::Stationary);
 	}
+
+	// 호드 적이 따라올 흐름장 계산 시작
+	if (UFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UFlowFieldSubsystem>())
+	{
+		FlowField->SetGoal(this);
+	}
 }
 
 void AHomeBase::Die()
@@ -39,4 +47,10 @@ void AHomeBase::Die()
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 
+	// 기지를 노리던 유닛들의 타겟 정리
+	if (UUnitDeathEventSubsystem* DeathEvents = GetWorld()->GetSubsystem<UUnitDeathEventSubsystem>())
+	{
+		DeathEvents->NotifyDeath(this);
+	}
+
 }
\ No newline at end of file
@@ -3,8 +3,8 @@
 #include "Objects/UnitSpawner.h"
 #include "Characters/AIUnit/BaseUnit.h"
 #include "Framework/System/ObjectPoolSubsystem.h"
-#include "Framework/InGame/MyAIController.h"
-#include "BehaviorTree/BehaviorTree.h"
+#include "Framework/System/BackgroundUnitSubsystem.h"
+#include "Framework/System/BattleRandomSubsystem.h"
 #include "NavigationSystem.h"
 #include "DrawDebugHelpers.h"
 
@@ -20,14 +20,38 @@ void AUnitSpawner::BeginPlay()
 	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
 	if (PoolSubsystem && UnitClass)
 	{
-		for (int32 i = 0; i < PreSpawnCount; i++)
-		{
-			ABaseUnit* TempUnit = PoolSubsystem->SpawnPoolActor<ABaseUnit>(UnitClass, GetActorLocation(), GetActorRotation(), this, nullptr);
-			if (TempUnit) PoolSubsystem->ReturnToPool(TempUnit);
-		}
+		UnitPoolHandle = PoolSubsystem->ResolvePoolHandle(UnitClass);
+	}
+
+	if (PoolSubsystem && UnitClass && PreSpawnCount > 0)
+	{
+		// 한 프레임에 몰아서 생성하지 않고 풀 서브시스템이 프레임 예산 안에서 나눠 생성합니다.
+		FPoolPrewarmRequest Request;
+		Request.ActorClass = UnitClass;
+		Request.Count = PreSpawnCount;
+		Request.SpawnLocation = GetActorLocation();
+		PoolSubsystem->RequestPrewarm({ Request });
+	}
+
+	// 예열이 끝나기 전에 웨이브가 시작되면 미스(SpawnActor)가 다시 발생하므로 완료를 기다립니다.
+	if (PoolSubsystem && PoolSubsystem->IsPrewarming())
+	{
+		PoolSubsystem->OnPrewarmCompleted.AddUniqueDynamic(this, &AUnitSpawner::StartWaves);
+	}
+	else
+	{
+		StartWaves();
 	}
+}
 
-	if (WaveConfigs.Num() > 0)
+void AUnitSpawner::StartWaves()
+{
+	if (UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>())
+	{
+		PoolSubsystem->OnPrewarmCompleted.RemoveDynamic(this, &AUnitSpawner::StartWaves);
+	}
+
+	if (WaveConfigs.Num() > 0 && !GetWorldTimerManager().IsTimerActive(SpawnTimerHandle))
 	{
 		GetWorldTimerManager().SetTimer(SpawnTimerHandle, this, &AUnitSpawner::SpawnUnit, WaveConfigs[0].SpawnInterval, true, 1.0f);
 	}
@@ -44,15 +68,21 @@ void AUnitSpawner::SpawnUnit()
 	EnemyRowName = WaveConfigs[CurrentWaveIndex].UnitRowName;
 	UObjectPoolSubsystem* PoolSubsystem = GetWorld()->GetSubsystem<UObjectPoolSubsystem>();
 
-	if (!PoolSubsystem || !UnitClass || !StatsDataTable || !AssetsDataTable || EnemyRowName.IsNone())
+	if (!PoolSubsystem || !UnitPoolHandle.IsValid() || !StatsDataTable || !AssetsDataTable || EnemyRowName.IsNone())
 	{
 		return;
 	}
 
-	FVector SpawnLocation = GetRandomSpawnLocation() + FVector(0.f, 0.f, 100.0f);
-	FRotator SpawnRotation = FRotator(0.f, FMath::RandRange(0.f, 360.f), 0.f);
+	const FVector GroundLocation = GetRandomSpawnLocation();
+	FVector SpawnLocation = GroundLocation + FVector(0.f, 0.f, 100.0f);
+	FRandomStream* SpawnStream = UBattleRandomSubsystem::FindStream(this, EBattleRandomStream::SpawnPosition);
+	FRotator SpawnRotation = FRotator(0.f, SpawnStream ? SpawnStream->FRandRange(0.f, 360.f) : FMath::RandRange(0.f, 360.f), 0.f);
+
+	// 배경 유닛으로 등록되면 교전 거리에 들어올 때 서브시스템이 같은 데이터 행으로 액터를 꺼냄
+	UBackgroundUnitSubsystem* Background = bSpawnAsBackground && UBackgroundUnitSubsystem::IsEnabled() ? GetWorld()->GetSubsystem<UBackgroundUnitSubsystem>() : nullptr;
+	const bool bSpawnedAsBackground = Background && Background->AddUnit(UnitClass, StatsDataTable, AssetsDataTable, EnemyRowName, GroundLocation, SpawnRotation.Yaw);
 
-	ABaseUnit* NewUnit = PoolSubsystem->SpawnPoolActor<ABaseUnit>(UnitClass, SpawnLocation, SpawnRotation, this, nullptr);
+	ABaseUnit* NewUnit = bSpawnedAsBackground ? nullptr : PoolSubsystem->SpawnPoolActor<ABaseUnit>(UnitPoolHandle, SpawnLocation, SpawnRotation, this, nullptr);
 
 	if (NewUnit)
 	{
@@ -67,36 +97,7 @@ void AUnitSpawner::SpawnUnit()
 		if (StatData && AssetData)
 		{
 			NewUnit->InitializeUnit(StatData, AssetData);
-
-			// AI 컨트롤러 확인
-			AMyAIController* AIC = Cast<AMyAIController>(NewUnit->GetController());
-
-			// 컨트롤러가 없다면 생성
-			if (!AIC)
-			{
-				NewUnit->SpawnDefaultController();
-				AIC = Cast<AMyAIController>(NewUnit->GetController());
-			}
-
-			if (AIC)
-			{
-				/** * [핵심 수정] AIC->Possess(NewUnit) 수동 호출을 제거합니다.
-				 */
-
-				 // 1. 블랙보드에 데이터 테이블 스탯 주입
-				AIC->LoadUnitStatsFromTable();
-
-				// 2. 비헤이비어 트리 실행
-				if (!AssetData->BehaviorTree.IsNull())
-				{
-					UBehaviorTree* BT = AssetData->BehaviorTree.LoadSynchronous();
-					if (BT)
-					{
-						AIC->RunBehaviorTree(BT);
-						UE_LOG(LogTemp, Log, TEXT("🚀 [%s] Behavior Tree Started Successfully."), *NewUnit->GetName());
-					}
-				}
-			}
+			NewUnit->StartAIBehavior(StatData, AssetData);
 		}
 	}
 
@@ -121,7 +122,13 @@ void AUnitSpawner::SpawnUnit()
 FVector AUnitSpawner::GetRandomSpawnLocation()
 {
 	FVector Origin = GetActorLocation();
-	FVector TargetPoint = Origin + FVector(FMath::RandRange(-SpawnExtent.X, SpawnExtent.X), FMath::RandRange(-SpawnExtent.Y, SpawnExtent.Y), 0.0f);
+
+	// 전투 시드 스트림 (같은 시드면 같은 위치에 스폰)
+	FRandomStream* SpawnStream = UBattleRandomSubsystem::FindStream(this, EBattleRandomStream::SpawnPosition);
+	const FVector Offset = SpawnStream
+		? FVector(SpawnStream->FRandRange(-SpawnExtent.X, SpawnExtent.X), SpawnStream->FRandRange(-SpawnExtent.Y, SpawnExtent.Y), 0.0f)
+		: FVector(FMath::RandRange(-SpawnExtent.X, SpawnExtent.X), FMath::RandRange(-SpawnExtent.Y, SpawnExtent.Y), 0.0f);
+	FVector TargetPoint = Origin + Offset;
 
 	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
 	FNavLocation NavLocation;
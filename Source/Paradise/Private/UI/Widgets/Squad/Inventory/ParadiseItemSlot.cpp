@@ -5,6 +5,7 @@
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
+#include "GAS/System/ParadiseGameplayTags.h"
 
 void UParadiseItemSlot::NativeConstruct()
 {
@@ -82,11 +83,11 @@ void UParadiseItemSlot::UpdateRankColor(FGameplayTag RankTag)
 	FLinearColor BorderColor = FLinearColor::White; // 기본값
 
 	// 태그 매칭 로직 (프로젝트 규칙에 맞게 수정)
-	if (RankTag.MatchesTag(FGameplayTag::RequestGameplayTag("Unit.Rank.S")))
+	if (RankTag.MatchesTag(FParadiseGameplayTags::Get().Unit_Rank_S))
 	{
 		BorderColor = FLinearColor(1.0f, 0.8f, 0.0f); // Gold
 	}
-	else if (RankTag.MatchesTag(FGameplayTag::RequestGameplayTag("Unit.Rank.A")))
+	else if (RankTag.MatchesTag(FParadiseGameplayTags::Get().Unit_Rank_A))
 	{
 		BorderColor = FLinearColor(0.8f, 0.0f, 1.0f); // Purple
 	}
@@ -4,16 +4,20 @@
 
 #include "CoreMinimal.h"
 #include "BehaviorTree/BTService.h"
+#include "Interfaces/ParadiseScheduledAIWork.h"
 #include "BTService_FindClosestTarget.generated.h"
 
 UCLASS()
-class PARADISE_API UBTService_FindClosestTarget : public UBTService
+class PARADISE_API UBTService_FindClosestTarget : public UBTService, public IParadiseScheduledAIWork
 {
 	GENERATED_BODY()
 
 public:
 	UBTService_FindClosestTarget();
 
+	/** @brief 실제 처리 (UAIWorkSchedulerSubsystem이 예산 안에서 호출, 스케줄러가 꺼져 있으면 TickNode에서 즉시 호출) */
+	virtual void ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp) override;
+
 protected:
 	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 
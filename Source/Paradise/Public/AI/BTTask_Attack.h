@@ -8,7 +8,7 @@
 
 /**
  * @class UBTTask_Attack
- * @brief 몬스터가 타겟에게 도달했을 때 공격 로직(로그 출력 등)을 수행하는 비헤이비어 트리 태스크 클래스입니다.
+ * @brief 몬스터가 타겟에게 도달했을 때 공격 로직(데미지 큐 게시)을 수행하는 비헤이비어 트리 태스크 클래스입니다.
  */
 UCLASS()
 class PARADISE_API UBTTask_Attack : public UBTTaskNode
@@ -28,4 +28,12 @@ public:
      * @return EBTNodeResult::Type 태스크의 성공, 실패, 또는 진행 중 상태를 반환합니다.
      */
     virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+protected:
+    /**
+     * @brief 공격력 배율 (1 = 공격자 BaseAttackPower 그대로)
+     * @details 데미지는 UDamageQueueSubsystem이 프레임 끝에 공격자/피해자 스탯으로 계산합니다.
+     */
+    UPROPERTY(EditAnywhere, Category = "Combat", meta = (ClampMin = "0.0"))
+    float DamageMultiplier = 1.0f;
 };
\ No newline at end of file
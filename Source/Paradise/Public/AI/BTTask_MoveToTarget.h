@@ -4,14 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "BehaviorTree/BTTaskNode.h"
+#include "Interfaces/ParadiseScheduledAIWork.h"
 #include "BTTask_MoveToTarget.generated.h"
 
 /**
  * @class UBTTask_MoveToTarget
  * @brief 블랙보드에 저장된 TargetLocation으로 몬스터를 이동시키는 태스크
+ * @details 이동 요청(경로 탐색)은 UAIWorkSchedulerSubsystem이 프레임 예산 안에서 실행합니다.
+ * 경로는 컨트롤러의 FindPathForMoveRequest가 UPathCacheSubsystem에서 같은 출발/도착 폴리곤의 통로를 재사용합니다.
+ * 목적지가 HomeBase이고 쫓는 적이 없으면 경로 탐색 대신 UFlowFieldSubsystem의 흐름장을 따릅니다.
  */
 UCLASS()
-class PARADISE_API UBTTask_MoveToTarget : public UBTTaskNode
+class PARADISE_API UBTTask_MoveToTarget : public UBTTaskNode, public IParadiseScheduledAIWork
 {
 	GENERATED_BODY()
 
@@ -23,6 +27,23 @@ public:
 	 */
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 
+	/**
+	 * @brief 대기 중인 이동 요청을 취소합니다.
+	 */
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	/**
+	 * @brief 스케줄러 차례가 왔을 때 이동을 요청하고 태스크를 마무리합니다.
+	 */
+	virtual void ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp) override;
+
 	UPROPERTY(EditAnywhere, Category = "Blackboard")
 	FBlackboardKeySelector TargetLocationKey;
+
+private:
+	/** @brief HomeBase로 향하는 이동이면 흐름장 추종으로 전환 (전환했으면 true) */
+	bool TryFollowFlowField(UBehaviorTreeComponent& OwnerComp) const;
+
+	/** @brief TargetLocation으로 이동 요청 */
+	EBTNodeResult::Type RequestMove(UBehaviorTreeComponent& OwnerComp) const;
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/**
+ * @file CrowdAvoidanceSolver.h
+ * @brief 전체 유닛의 군중 분리/회피를 한 번에 계산하는 배치 솔버 (UObject 비의존)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FCrowdAgentSnapshot
+ * @brief 한 프레임 동안의 에이전트 위치/속도/반경/우선순위 (SoA 배열, 2D)
+ */
+struct PARADISE_API FCrowdAgentSnapshot
+{
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> VelX;
+	TArray<float> VelY;
+	TArray<float> Radius;
+	TArray<float> Priority;
+
+	/** @brief 가장 큰 반경 (이웃 탐색 셀 크기 결정) */
+	float MaxRadius = 0.f;
+
+	void Reset(int32 ExpectedAgents = 0);
+
+	/** @brief 에이전트 한 개를 추가하고 슬롯 인덱스를 반환합니다. */
+	int32 Add(const FVector& Location, const FVector& Velocity, float InRadius, float InPriority);
+
+	int32 Num() const { return PosX.Num(); }
+};
+
+/** @brief 솔버 파라미터 */
+struct FCrowdAvoidanceParams
+{
+	/** @brief 이 시간(초) 안에 부딪힐 이웃만 미리 피함 */
+	float TimeHorizon = 0.75f;
+
+	/** @brief 예측 회피 세기 (0이면 겹침 분리만) */
+	float AvoidanceWeight = 1.f;
+
+	/** @brief 프레임당 최대 위치 보정(cm) */
+	float MaxPushPerFrame = 8.f;
+};
+
+/**
+ * @struct FCrowdAvoidanceResults
+ * @brief 솔버 결과 (스냅샷과 같은 슬롯 인덱스)
+ */
+struct PARADISE_API FCrowdAvoidanceResults
+{
+	/** @brief 겹침을 풀기 위한 위치 보정 */
+	TArray<FVector2f> Push;
+
+	/** @brief 회피를 반영한 새 속도 (속력은 유지) */
+	TArray<FVector2f> Velocity;
+
+	/** @brief 이웃과 겹쳐 있던 에이전트 수 */
+	int32 NumOverlapping = 0;
+};
+
+/**
+ * @struct FCrowdAvoidanceSolver
+ * @brief 분리(겹침 해소) + RVO 방식의 예측 회피
+ * @details
+ * 1. 셀 크기 = 최대 반경 × 2 로 에이전트를 셀 순서로 정렬
+ * 2. ParallelFor로 에이전트마다 주변 3x3 셀의 이웃만 검사
+ *    - 겹친 이웃: 우선순위 비율만큼 밀어냄
+ *    - TimeHorizon 안에 가장 가까워질 때 겹치는 이웃: 예상 접촉점 반대쪽으로 속도를 틀어줌
+ */
+struct PARADISE_API FCrowdAvoidanceSolver
+{
+	/** @param bParallel false면 단일 스레드로 실행 (부하 측정 비교용) */
+	static void Solve(const FCrowdAgentSnapshot& Snapshot, const FCrowdAvoidanceParams& Params, FCrowdAvoidanceResults& OutResults, bool bParallel = true);
+};
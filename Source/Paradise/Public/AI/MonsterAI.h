@@ -33,4 +33,5 @@ namespace BB_KEYS
     const FName TargetLocation = TEXT("TargetLocation");
     const FName DistanceToTarget = TEXT("DistanceToTarget");
     const FName AIState = TEXT("AIState");
+    const FName HomeBaseActor = TEXT("HomeBaseActor");
 }
\ No newline at end of file
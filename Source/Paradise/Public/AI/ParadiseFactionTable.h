@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/**
+ * @file ParadiseFactionTable.h
+ * @brief 진영 태그 → 작은 정수 ID 변환과 미리 계산된 적대 비트마스크 (UObject 비의존)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Data/Structs/FactionStructs.h"
+
+class UFactionConfig;
+
+/**
+ * @struct FParadiseFactionTable
+ * @brief 게임 전역 진영 테이블
+ * @details
+ * - 유닛은 InitializeUnit 시점에 FactionTag를 한 번 ID로 바꿔 두고, 이후 적대 판정은 비트 연산 한 번입니다.
+ * - ID는 처음 본 순서대로 발급되며 바뀌지 않습니다. 설정(ApplyConfig)이 바뀌면 마스크만 다시 계산합니다.
+ * - 최대 32진영 (마스크 = uint32). 게임 스레드 전용.
+ */
+struct PARADISE_API FParadiseFactionTable
+{
+	static constexpr int32 MaxFactions = 32;
+	static constexpr uint8 InvalidId = 0xFF;
+
+	static FParadiseFactionTable& Get();
+
+	/** @brief 진영 태그의 ID (처음 보는 태그면 발급) */
+	uint8 FindOrAddFaction(const FGameplayTag& FactionTag);
+
+	/** @brief ID의 진영 태그 */
+	const FGameplayTag& GetFactionTag(uint8 FactionId) const;
+
+	/** @brief 발급된 진영 수 */
+	int32 Num() const { return FactionTags.Num(); }
+
+	/** @brief A에게 B가 적인지 */
+	FORCEINLINE bool IsHostile(uint8 A, uint8 B) const
+	{
+		return A < MaxFactions && B < MaxFactions && (HostileMasks[A] & (1u << B)) != 0;
+	}
+
+	/** @brief A의 적 진영 비트마스크 (비트 B가 켜져 있으면 B는 적) */
+	FORCEINLINE uint32 GetHostileMask(uint8 A) const
+	{
+		return A < MaxFactions ? HostileMasks[A] : 0u;
+	}
+
+	/** @brief 스테이지 설정 적용 (nullptr이면 기본 규칙: 태그가 일치하지 않으면 적) */
+	void ApplyConfig(const UFactionConfig* Config);
+
+private:
+	FParadiseFactionTable();
+
+	/**
+	 * @brief 설정 규칙으로 두 진영의 관계를 판정합니다. (마스크 계산용, 느림)
+	 * @note 태그가 없는 진영은 설정과 상관없이 자기 자신을 포함한 모든 진영과 적대입니다.
+	 * Unit.Faction.Friendly 하위 진영끼리는 Relations에 따로 없으면 동맹입니다.
+	 */
+	bool EvaluateHostility(const FGameplayTag& A, const FGameplayTag& B) const;
+
+	bool IsNeutral(const FGameplayTag& FactionTag) const;
+
+	/** @brief 전체 마스크 재계산 */
+	void RebuildMasks();
+
+	TArray<FGameplayTag> FactionTags;
+	uint32 HostileMasks[MaxFactions];
+
+	/** @brief 적용 중인 설정 (복사본) */
+	FGameplayTagContainer NeutralFactions;
+	TArray<FFactionRelation> Relations;
+	bool bHostileOnTagMismatch = true;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/**
+ * @file UnitTargetingSolver.h
+ * @brief 전체 유닛의 최근접 적을 한 번에 계산하는 배치 솔버 (UObject 비의존)
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FUnitTargetingSnapshot
+ * @brief 한 프레임 동안의 유닛 위치/진영 스냅샷 (SoA 배열)
+ * @details 인덱스 = 유닛 슬롯. 진영 수는 비트마스크 크기(32)로 제한됩니다.
+ */
+struct PARADISE_API FUnitTargetingSnapshot
+{
+	static constexpr int32 MaxFactions = 32;
+
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> PosZ;
+	TArray<int32> Faction;
+
+	/** @brief 진영별 적대 진영 비트마스크 (HostileMask[A] & (1 << B) 이면 A에게 B는 적) */
+	TArray<uint32> HostileMask;
+
+	void Reset(int32 ExpectedUnits = 0);
+
+	/** @brief 유닛 한 개를 추가하고 슬롯 인덱스를 반환합니다. */
+	int32 Add(const FVector& Location, int32 FactionIndex);
+
+	int32 Num() const { return PosX.Num(); }
+};
+
+/**
+ * @struct FUnitTargetingResults
+ * @brief 솔버 결과 테이블 (스냅샷과 같은 슬롯 인덱스)
+ */
+struct PARADISE_API FUnitTargetingResults
+{
+	/** @brief 가장 가까운 적의 슬롯 (없으면 INDEX_NONE) */
+	TArray<int32> TargetSlot;
+
+	/** @brief 가장 가까운 적까지의 거리 (없으면 MAX_flt) */
+	TArray<float> Distance;
+};
+
+/**
+ * @struct FUnitTargetingSolver
+ * @brief 스냅샷 전체의 최근접 적을 계산합니다.
+ * @details
+ * 1. 셀 크기 = MaxRadius 로 유닛을 셀 순서로 정렬해 연속 배열로 재배치
+ * 2. ParallelFor로 유닛마다 주변 3x3 셀만 검사 (거리 계산은 4개씩 SIMD)
+ */
+struct PARADISE_API FUnitTargetingSolver
+{
+	/**
+	 * @brief 셀 정렬 + 병렬 + SIMD 버전
+	 * @param MaxRadius 이 거리 밖의 적은 무시합니다.
+	 * @param bParallel false면 단일 스레드로 실행 (벤치마크 비교용)
+	 */
+	static void Solve(const FUnitTargetingSnapshot& Snapshot, float MaxRadius, FUnitTargetingResults& OutResults, bool bParallel = true);
+
+	/** @brief 기존 BT 서비스와 같은 O(N²) 전수 검사 (벤치마크/검증용) */
+	static void SolveBruteForce(const FUnitTargetingSnapshot& Snapshot, float MaxRadius, FUnitTargetingResults& OutResults);
+};
@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "Interfaces/ObjectPoolInterface.h"
 #include "Data/Structs/UnitStructs.h"
 #include "GameplayTagContainer.h"
+#include "AI/ParadiseFactionTable.h"
 #include "BaseUnit.generated.h"
 
 UCLASS()
@@ -23,17 +25,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Unit|Status")
 	float MaxHP;
 
+	/** @note 런타임에 바꿀 때는 SetFactionTag를 사용해야 진영 ID/격자가 함께 갱신됩니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Unit|Status")
 	FGameplayTag FactionTag;
 
+	/** @brief FactionTag를 FParadiseFactionTable에서 변환한 진영 ID (적대 판정용) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Status")
+	uint8 FactionId = FParadiseFactionTable::InvalidId;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Status")
 	bool bIsDead;
 
+	/** @brief 역할군 (Unit.Role.*, 군중 회피 반경/우선순위 조회에 사용) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Status")
+	FGameplayTag RoleTypeTag;
+
+	/** @brief 현재 AI LOD 단계 (0 = 가장 정밀, UAILODSubsystem이 갱신) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|AI")
+	uint8 AILODTier = 0;
+
+	/** @brief 메시에 원래 설정된 VisibilityBasedAnimTickOption (BeginPlay에서 저장, AI LOD 단계 0에서 복원) */
+	EVisibilityBasedAnimTickOption DefaultAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+
 protected:
 	/** @brief 데이터 테이블 조회를 위한 RowName 저장 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Data")
 	FName UnitID;
 
+protected:
+	/** @brief 공간 격자(UUnitSpatialGridSubsystem) 등록/해제 */
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 	/** 오브젝트 풀 인터페이스 구현 */
 	virtual void OnPoolActivate_Implementation() override;
@@ -42,15 +65,63 @@ public:
 	/** @brief 유닛 초기화 및 ID 설정 */
 	void InitializeUnit(struct FAIUnitStats* InStats, struct FAIUnitAssets* InAssets);
 
+	/**
+	 * @brief AI 컨트롤러를 확보(없으면 생성)하고 데이터 행의 BT를 시작합니다.
+	 * @details 풀에서 재사용된 유닛은 휴면 상태의 컨트롤러를 그대로 깨웁니다. InitializeUnit 이후에 호출합니다.
+	 */
+	void StartAIBehavior(const struct FAIUnitStats* InStats, const struct FAIUnitAssets* InAssets);
+
 	void SetUnitID(FName InID) { UnitID = InID; }
 	FName GetUnitID() const { return UnitID; }
 
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 	virtual void Die();
 
+	/**
+	 * @brief 데미지 큐(UDamageQueueSubsystem)에서 합산된 데미지를 HP에 반영합니다.
+	 * @details 사망 처리(Die)는 호출 측이 한 프레임의 모든 대상을 반영한 뒤 호출합니다.
+	 * @return 이번 데미지로 사망했으면 true
+	 */
+	bool ApplyQueuedDamage(float Damage);
+
+	/** @brief 캐시 스탯 (InitializeUnit에서 데이터 행으로 설정) */
+	float GetAttackPower() const { return AttackPower; }
+	float GetDefense() const { return Defense; }
+	float GetCritRate() const { return CritRate; }
+
+	/** @brief 진영을 바꾸고 진영 ID와 공간 격자 버킷을 갱신합니다. */
+	UFUNCTION(BlueprintCallable, Category = "Unit|Logic")
+	void SetFactionTag(const FGameplayTag& NewFactionTag);
+
+	/** @brief 적대 판정 (진영 테이블 비트마스크 조회 한 번) */
 	UFUNCTION(BlueprintCallable, Category = "Unit|Logic")
 	bool IsEnemy(ABaseUnit* OtherUnit);
 
+	/**
+	 * @brief 대상을 향해 투사체를 발사합니다. (UProjectileSubsystem)
+	 * @details 대상의 현재 속도로 도착 시점 위치를 예측해 조준합니다.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
-	void PlayRangeAttack();
+	void PlayRangeAttack(AActor* Target);
+
+protected:
+	/** @brief 원거리 평타 투사체 종류 (InitializeUnit에서 데이터 행으로 설정) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Combat")
+	FGameplayTag ProjectileType;
+
+	/** @brief 공격력 (InitializeUnit에서 BaseAttackPower로 설정) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Combat")
+	float AttackPower = 0.f;
+
+	/** @brief 방어력 (InitializeUnit에서 BaseDefense로 설정) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Combat")
+	float Defense = 0.f;
+
+	/** @brief 치명타 확률 0~1 (InitializeUnit에서 BaseCritRate로 설정) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Combat")
+	float CritRate = 0.f;
+
+	/** @brief ASC가 있는 대상에게 적용할 평타 GE */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Unit|Combat")
+	TSubclassOf<class UGameplayEffect> BasicAttackEffect;
 };
\ No newline at end of file
@@ -59,11 +59,13 @@ protected:
 
 
 	/* 
-	 * @brief DamagePopup(데미지위젯)을 스폰(오브젝트 풀링)시키는 함수  
-	 * @param DamageAmount 위젯에 설정할 데미지수치
+	 * @brief 머리 위에 데미지 숫자를 띄우는 함수
+	 * @details 액터/위젯을 생성하지 않고 UDamagePopupSubsystem의 링 버퍼에 추가합니다.
+	 * @param DamageAmount 표시할 데미지수치
+	 * @param bIsCritical  치명타 여부 (크기/색상 강조)
 	 */
 	UFUNCTION(BlueprintCallable)
-	void SpawnDamagePopup(float DamageAmount);
+	void SpawnDamagePopup(float DamageAmount, bool bIsCritical = false);
 
 
 public:
@@ -86,12 +88,6 @@ protected:
 	TObjectPtr<class UWidgetComponent> HealthWidget = nullptr;
 
 
-	/*
-	 * @brief 데미지팝업위젯 액터 할당예정 (클래스타입도 해당 UI타입으로 변경예정)
-	*/
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamagePopupActor")
-	TSubclassOf<class AActor> DamageTextActorClass = nullptr;
-
 	/*
 	 * @brief 실제 무기 액터 인스턴스
 	 */
@@ -7,13 +7,17 @@
 #include "TestNotifyState.generated.h"
 
 /**
- * 
+ * @brief 근접 공격 판정 구간
+ * @details 구간 시작/끝에서 오너의 UMeleeHitDetectionComponent 스윙을 켜고 끕니다. (구간 안의 판정은 컴포넌트가 매 프레임 처리)
  */
 UCLASS()
 class PARADISE_API UTestNotifyState : public UAnimNotifyState
 {
 	GENERATED_BODY()
 
-	// 틱마다(매 프레임) 호출됨 (공격 중인 동안 계속 검사)
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+	// 판정 구간 시작 (타격 목록 초기화 + 스윕 시작)
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+
+	// 판정 구간 끝 (몽타주가 끊겨도 호출됨)
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 };
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "MeleeHitDetectionComponent.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ * @class UMeleeHitDetectionComponent
+ * @brief 근접 공격 타격 판정을 프레임 사이 스윕으로 처리하는 컴포넌트
+ * @details
+ * - 스윙 동안 매 프레임 '지난 프레임 소켓 위치 → 이번 프레임 소켓 위치'를 구체로 비동기 스윕(Multi)합니다.
+ *   프레임 사이를 빈틈없이 훑으므로 공격 속도가 빨라도 판정이 새지 않습니다.
+ * - 비동기 결과는 다음 프레임에 읽습니다. (EndSwing 뒤에도 남은 결과를 받을 때까지 한 프레임 더 틱)
+ * - 한 스윙에서 같은 액터는 한 번만 맞고, 한 프레임에 새로 맞은 대상들은 Event.Montage.Hit 하나로 묶어 보냅니다.
+ *   (Payload.Target = 첫 대상, Payload.TargetData = 전체 대상)
+ * - 디버그 드로잉: paradise.melee.DebugDraw 1
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class PARADISE_API UMeleeHitDetectionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** @brief 생성자: 스윙 중에만 틱하도록 꺼둔 상태로 시작 */
+	UMeleeHitDetectionComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/**
+	 * @brief 스윙 시작. 타격 목록을 비우고 현재 소켓 위치부터 추적합니다.
+	 * @param InMesh 공격 몽타주를 재생하는 메시 (nullptr이면 오너 캐릭터의 메시)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void BeginSwing(USkeletalMeshComponent* InMesh = nullptr);
+
+	/** @brief 스윙 종료. 새 스윕은 멈추고, 이미 보낸 스윕 결과만 다음 프레임에 마저 처리합니다. */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void EndSwing();
+
+	UFUNCTION(BlueprintPure, Category = "Combat")
+	bool IsSwinging() const { return bIsSwinging; }
+
+protected:
+	/** @brief 지난 프레임에 보낸 스윕 결과를 읽어 새 타격 대상을 모읍니다. */
+	void ConsumeTraceResults(TArray<AActor*>& OutNewHits);
+
+	/** @brief 지난 소켓 위치부터 현재 소켓 위치까지 스윕을 요청합니다. */
+	void IssueSweep();
+
+	/** @brief 모은 대상을 Event.Montage.Hit 하나로 묶어 오너에게 보냅니다. */
+	void SendHitEvent(const TArray<AActor*>& NewHits) const;
+
+	FVector GetSocketLocation() const;
+
+protected:
+	/** @brief 판정 기준 소켓 (무기 끝/손) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
+	FName SocketName = TEXT("hand_r");
+
+	/** @brief 판정 구체 반경 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (ClampMin = "1.0"))
+	float Radius = 50.0f;
+
+	/** @brief 검사할 채널 */
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Pawn;
+
+private:
+	UPROPERTY()
+	TWeakObjectPtr<USkeletalMeshComponent> SwingMesh;
+
+	/** @brief 이번 스윙에서 이미 맞은 대상 (다단히트 방지) */
+	TSet<TWeakObjectPtr<AActor>> HitThisSwing;
+
+	/** @brief 결과를 기다리는 스윕 */
+	TArray<FTraceHandle> PendingTraces;
+
+	FVector PrevSocketLocation = FVector::ZeroVector;
+
+	bool bIsSwinging = false;
+};
@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SquadAIControllerComponent.generated.h"
+
+class AAIController;
+class APawn;
+class UBehaviorTree;
+
+/**
+ * @struct FSquadSwapStats
+ * @brief 영웅 교체(빙의 전환) 소요 시간 통계
+ */
+USTRUCT(BlueprintType)
+struct FSquadSwapStats
+{
+	GENERATED_BODY()
+
+	/** @brief 누적 교체 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "Squad|Stats")
+	int32 SwapCount = 0;
+
+	/** @brief 마지막 교체 소요 시간 (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Squad|Stats")
+	float LastSwapMs = 0.f;
+
+	/** @brief 최대 교체 소요 시간 (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Squad|Stats")
+	float MaxSwapMs = 0.f;
+
+	/** @brief 누적 교체 소요 시간 (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Squad|Stats")
+	float TotalSwapMs = 0.f;
+
+	float GetAverageMs() const { return SwapCount > 0 ? TotalSwapMs / SwapCount : 0.f; }
+};
+
+/**
+ * @class USquadAIControllerComponent
+ * @brief 스쿼드 슬롯마다 AI 컨트롤러를 하나씩 소유하고 재사용하는 컴포넌트
+ * @details 영웅 교체 시 AI 컨트롤러를 생성/파괴하지 않고 빙의만 주고받습니다.
+ * - 플레이어가 가져갈 때: BT를 일시정지(PauseLogic)한 뒤 빙의 해제 (블랙보드/노드 메모리 유지)
+ * - AI에게 돌려줄 때: 같은 육체라면 멈췄던 지점부터 재개(ResumeLogic), 새 육체(부활)라면 재시작
+ * 슬롯 컨트롤러는 bStopAILogicOnUnposses/bStartAILogicOnPossess를 끈 상태로 생성합니다.
+ * PlayerController(AInGameController)에 부착하여 사용합니다.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class PARADISE_API USquadAIControllerComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USquadAIControllerComponent();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	/**
+	 * @brief 슬롯의 AI 컨트롤러에게 육체를 맡깁니다.
+	 * @details 슬롯 컨트롤러가 없으면 1회 생성합니다. 그 외에는 생성/파괴가 발생하지 않습니다.
+	 * @param SlotIndex       스쿼드 슬롯 인덱스
+	 * @param Pawn            AI가 조종할 육체
+	 * @param ControllerClass 슬롯 컨트롤러를 처음 만들 때 사용할 클래스
+	 */
+	void HandOffToAI(int32 SlotIndex, APawn* Pawn, TSubclassOf<AAIController> ControllerClass);
+
+	/**
+	 * @brief 슬롯의 AI 컨트롤러에게서 육체를 회수합니다. (플레이어가 빙의하기 직전에 호출)
+	 * @details BT를 일시정지하고 이동을 멈춘 뒤 빙의를 해제합니다. 컨트롤러는 유지됩니다.
+	 * 육체가 슬롯 밖의 AI 컨트롤러(스폰 시 자동 생성 등)에 잡혀 있으면 그 컨트롤러는 정리합니다.
+	 * @param Pawn 플레이어가 빙의할 육체 (nullptr이면 슬롯이 마지막으로 조종한 육체)
+	 */
+	void TakeFromAI(int32 SlotIndex, APawn* Pawn = nullptr);
+
+	/** @brief 슬롯의 AI 컨트롤러 (아직 없으면 nullptr) */
+	AAIController* GetSlotController(int32 SlotIndex) const;
+
+	/** @brief 교체 소요 시간 기록 */
+	void RecordSwap(double SwapMs);
+
+	/** @brief 교체 소요 시간 통계 */
+	UFUNCTION(BlueprintPure, Category = "Squad|Stats")
+	const FSquadSwapStats& GetSwapStats() const { return SwapStats; }
+
+	/** @brief 교체 통계를 로그로 출력합니다. (paradise.squad.swapstats) */
+	void DumpSwapStats() const;
+
+protected:
+	/**
+	 * @brief 슬롯 컨트롤러가 BT를 직접 실행하지 않는 경우(BP OnPossess 미구현 등) 사용할 BT
+	 * @details 비워두면 컨트롤러 클래스의 기존 동작(OnPossess 등)에 맡깁니다.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Squad|AI")
+	TObjectPtr<UBehaviorTree> SquadBehaviorTree = nullptr;
+
+private:
+	/** @brief 슬롯 컨트롤러를 가져오거나 1회 생성합니다. */
+	AAIController* GetOrCreateSlotController(int32 SlotIndex, APawn* Pawn, TSubclassOf<AAIController> ControllerClass);
+
+	/** @brief 사망 등으로 육체를 잃은 슬롯 컨트롤러의 BT를 멈춥니다. */
+	UFUNCTION()
+	void HandleSlotPawnChanged(APawn* OldPawn, APawn* NewPawn);
+
+	/** @brief 슬롯별 AI 컨트롤러 (인덱스 = 스쿼드 슬롯) */
+	UPROPERTY()
+	TArray<TObjectPtr<AAIController>> SlotControllers;
+
+	/** @brief 슬롯 컨트롤러가 마지막으로 조종했던 육체 (같은 육체면 BT 재개, 다르면 재시작) */
+	TArray<TWeakObjectPtr<APawn>> SlotLastPawns;
+
+	UPROPERTY()
+	FSquadSwapStats SwapStats;
+};
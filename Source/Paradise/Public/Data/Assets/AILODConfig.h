@@ -0,0 +1,27 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Data/Structs/AILODStructs.h"
+#include "AILODConfig.generated.h"
+
+/**
+ * @class UAILODConfig
+ * @brief AI LOD 단계 설정 (InGameGameMode에서 UAILODSubsystem에 전달)
+ */
+UCLASS()
+class PARADISE_API UAILODConfig : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+    // 단계 목록 (0 = 가장 정밀, 마지막 = 조건 없이 나머지 전부)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "LOD")
+    TArray<FAILODTierSettings> Tiers;
+
+    // 덜 정밀한 단계로 내려갈 때 현재 단계 조건을 이 배율만큼 넓혀서 한 번 더 검사 (단계 깜빡임 방지)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "LOD", meta = (ClampMin = "1.0"))
+    float HysteresisScale = 1.2f;
+};
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "Data/Structs/CrowdStructs.h"
+#include "CrowdConfig.generated.h"
+
+/**
+ * @class UCrowdConfig
+ * @brief 역할군(RoleTypeTag)별 군중 회피 설정 (InGameGameMode에서 UCrowdSubsystem에 전달)
+ */
+UCLASS()
+class PARADISE_API UCrowdConfig : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+    // 역할군 태그에 설정이 없는 유닛이 쓰는 값
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Crowd")
+    FCrowdAgentSettings DefaultSettings;
+
+    // 역할군별 설정 (예: Unit.Role.Tanker는 반경을 키우고 우선순위를 높게)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Crowd", meta = (Categories = "Unit.Role"))
+    TMap<FGameplayTag, FCrowdAgentSettings> RoleSettings;
+};
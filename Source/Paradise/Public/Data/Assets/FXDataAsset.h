@@ -22,9 +22,28 @@ public:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Data", meta = (Categories = "Effect, State"))
     TMap<FGameplayTag, FCombatFXSet> EffectMap;
 
+    // 사운드 동시 재생 제한 (태그별 사운드가 한꺼번에 몰릴 때 보이스 수 제한)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Data")
+    TObjectPtr<class USoundConcurrency> SoundConcurrency;
+
     // 검색 함수
     FCombatFXSet* FindEffect(const FGameplayTag& Tag)
     {
         return EffectMap.Find(Tag);
     }
+
+    const FCombatFXSet* FindEffect(const FGameplayTag& Tag) const
+    {
+        return EffectMap.Find(Tag);
+    }
+
+    // 비동기 프리로드용: EffectMap이 참조하는 모든 VFX/SFX 경로 수집
+    void GetAllAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+    {
+        for (const TPair<FGameplayTag, FCombatFXSet>& Pair : EffectMap)
+        {
+            if (!Pair.Value.VisualEffect.IsNull()) OutPaths.AddUnique(Pair.Value.VisualEffect.ToSoftObjectPath());
+            if (!Pair.Value.SoundEffect.IsNull()) OutPaths.AddUnique(Pair.Value.SoundEffect.ToSoftObjectPath());
+        }
+    }
 };
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "Data/Structs/FactionStructs.h"
+#include "FactionConfig.generated.h"
+
+/**
+ * @class UFactionConfig
+ * @brief 스테이지별 진영 적대 관계 설정 (InGameGameMode에서 FParadiseFactionTable에 적용)
+ * @details 판정 순서: 태그 없음(모두와 적) → 같은 진영 → 중립 → Relations(위에서부터 처음 일치하는 줄) → 아군(Unit.Faction.Friendly.*)끼리 동맹 → 기본 규칙
+ */
+UCLASS()
+class PARADISE_API UFactionConfig : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+    // 아무와도 적대하지 않는 진영 (Unit.Faction.Neutral은 항상 중립)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Faction", meta = (Categories = "Unit.Faction"))
+    FGameplayTagContainer NeutralFactions;
+
+    // 직접 지정한 진영 간 관계 (다진영 스테이지, 동맹 등)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Faction")
+    TArray<FFactionRelation> Relations;
+
+    // Relations에 없는 쌍의 기본 규칙: true면 태그가 일치하지 않으면 적 (기존 IsEnemy 규칙), false면 중립
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Faction")
+    bool bHostileOnTagMismatch = true;
+};
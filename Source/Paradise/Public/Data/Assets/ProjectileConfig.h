@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "Data/Structs/ProjectileStructs.h"
+#include "ProjectileConfig.generated.h"
+
+/**
+ * @class UProjectileConfig
+ * @brief 투사체 종류(태그)별 비행/외형 설정 (InGameGameMode에서 UProjectileSubsystem에 전달)
+ */
+UCLASS()
+class PARADISE_API UProjectileConfig : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+    // 종류 태그가 비어 있거나 설정에 없는 투사체가 쓰는 값
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile")
+    FProjectileTypeSettings DefaultType;
+
+    // 종류별 설정 (예: Projectile.Arrow, Projectile.FireBall)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile", meta = (Categories = "Projectile"))
+    TMap<FGameplayTag, FProjectileTypeSettings> Types;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "AILODStructs.generated.h"
+
+/**
+ * @struct FAILODTierSettings
+ * @brief AI LOD 단계 하나의 진입 조건과 갱신 주기
+ * @details 단계 0이 가장 정밀하며, 유닛은 조건을 만족하는 가장 낮은 번호의 단계에 들어갑니다.
+ * 시야(카메라) 거리 또는 전선(가장 가까운 적) 거리 중 하나만 만족해도 진입합니다.
+ */
+USTRUCT(BlueprintType)
+struct FAILODTierSettings
+{
+    GENERATED_BODY()
+
+public:
+    // 카메라와의 거리가 이 값 이하이면 진입 (0 이하이면 시야 조건 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Condition")
+    float MaxViewDistance = 0.f;
+
+    // 시야 조건에 화면에 그려졌는지(WasRecentlyRendered)도 요구
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Condition")
+    bool bViewRequiresRendered = true;
+
+    // 가장 가까운 적과의 거리가 이 값 이하이면 진입 (0 이하이면 전선 조건 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Condition")
+    float MaxFrontLineDistance = 0.f;
+
+    // BT 서비스 실행 간격 배율 (FindClosestTarget 0.2초 × 배율)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Rate", meta = (ClampMin = "1.0"))
+    float ServiceIntervalScale = 1.f;
+
+    // AI 컨트롤러/경로 추적 컴포넌트 틱 간격 (0 = 매 프레임)
+    // BT 컴포넌트는 다음 노드 실행 시점에 맞춰 스스로 틱을 예약하므로 서비스 간격 배율로 함께 줄어듭니다.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Rate", meta = (ClampMin = "0.0"))
+    float ControllerTickInterval = 0.f;
+
+    // 캐릭터 무브먼트 틱 간격 (0 = 매 프레임)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Rate", meta = (ClampMin = "0.0"))
+    float MovementTickInterval = 0.f;
+
+    // 스켈레탈 메시 틱 간격 (0 = 매 프레임)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Rate", meta = (ClampMin = "0.0"))
+    float MeshTickInterval = 0.f;
+
+    // 화면 밖일 때의 애니메이션 갱신 방식 (단계 0에서는 무시하고 유닛 메시의 원래 설정을 씀)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "LOD|Rate")
+    EVisibilityBasedAnimTickOption AnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+};
@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CrowdStructs.generated.h"
+
+/**
+ * @struct FCrowdAgentSettings
+ * @brief 군중 회피에서 유닛 한 개가 차지하는 반경과 양보 우선순위
+ * @details 두 유닛이 겹치면 우선순위가 낮은 쪽이 더 많이 비켜납니다. (같으면 절반씩)
+ */
+USTRUCT(BlueprintType)
+struct FCrowdAgentSettings
+{
+    GENERATED_BODY()
+
+public:
+    // 회피 반경(cm). 캡슐 반경과 비슷하게 두고, 덩치 큰 역할군은 크게 잡습니다.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Crowd", meta = (ClampMin = "10.0"))
+    float Radius = 45.f;
+
+    // 우선순위 (높을수록 덜 비켜남, 0이면 항상 양보)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Crowd", meta = (ClampMin = "0.0"))
+    float Priority = 1.f;
+};
@@ -28,4 +28,12 @@ public:
     // 위치 오프셋 (필요하다면)
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FX")
     FVector LocationOffset = FVector::ZeroVector;
+
+    // 이 태그로 동시에 재생할 수 있는 최대 이펙트 수 (0이면 paradise.fx.DefaultMaxConcurrent 사용)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FX|Budget", meta = (ClampMin = "0"))
+    int32 MaxConcurrent = 0;
+
+    // 카메라에서 이 거리(cm)보다 멀면 사운드를 재생하지 않음 (0이면 거리 제한 없음)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FX|Budget", meta = (ClampMin = "0.0"))
+    float MaxAudibleDistance = 3000.f;
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "FactionStructs.generated.h"
+
+/**
+ * @struct FFactionRelation
+ * @brief 두 진영 사이의 적대 관계를 직접 지정하는 설정 한 줄 (양방향)
+ * @details 부모 태그로 지정하면 하위 진영 전체에 적용됩니다. (예: Unit.Faction.Friendly)
+ */
+USTRUCT(BlueprintType)
+struct FFactionRelation
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Faction", meta = (Categories = "Unit.Faction"))
+    FGameplayTag FactionA;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Faction", meta = (Categories = "Unit.Faction"))
+    FGameplayTag FactionB;
+
+    // true면 서로 적, false면 서로 공격하지 않음
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Faction")
+    bool bHostile = true;
+};
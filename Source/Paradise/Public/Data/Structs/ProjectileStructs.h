@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProjectileStructs.generated.h"
+
+class UStaticMesh;
+
+/**
+ * @struct FProjectileTypeSettings
+ * @brief 투사체 종류 한 개의 비행/판정/외형 설정
+ * @details 같은 종류의 투사체는 모두 하나의 인스턴스 메시(ISM)로 그려집니다. (UProjectileSubsystem)
+ */
+USTRUCT(BlueprintType)
+struct FProjectileTypeSettings
+{
+    GENERATED_BODY()
+
+public:
+    // 투사체 외형. 비워두면 보이지 않는 투사체로 판정만 합니다.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Visual")
+    TSoftObjectPtr<UStaticMesh> Mesh;
+
+    // 메시 크기 배율
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Visual", meta = (ClampMin = "0.01"))
+    float Scale = 1.f;
+
+    // 발사 속도(cm/s)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flight", meta = (ClampMin = "1.0"))
+    float Speed = 2000.f;
+
+    // 중력 배율 (0이면 직선 비행, 1이면 월드 중력 그대로)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flight", meta = (ClampMin = "0.0"))
+    float GravityScale = 0.f;
+
+    // 아무것도 맞히지 못했을 때 사라지기까지의 시간(초)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flight", meta = (ClampMin = "0.1"))
+    float Lifetime = 3.f;
+
+    // 판정 구체 반경(cm)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hit", meta = (ClampMin = "0.0"))
+    float Radius = 15.f;
+};
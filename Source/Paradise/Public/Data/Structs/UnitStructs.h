@@ -4,9 +4,11 @@
 #include "Data/Enums/GameEnums.h"
 #include "GameplayTagContainer.h"
 #include "GameplayEffect.h"
+#include "GAS/System/ParadiseGameplayTags.h"
 #include "UnitStructs.generated.h"
 
 class USkeletalMesh;
+class UStaticMesh;
 class UAnimInstance;
 class UTexture2D;
 class UGameplayAbility;
@@ -106,7 +108,7 @@ public:
 	*/
 	FCharacterStats()
 	{
-		FactionTag = FGameplayTag::RequestGameplayTag(FName("Unit.Faction.Friendly.Player"));
+		FactionTag = FParadiseGameplayTags::Get().Unit_Faction_Friendly_Player;
 	}
 
 	// =========================================================
@@ -245,7 +247,7 @@ public:
 	*/
 	FEnemyStats()
 	{
-		FactionTag = FGameplayTag::RequestGameplayTag(FName("Unit.Faction.Enemy"));
+		FactionTag = FParadiseGameplayTags::Get().Unit_Faction_Enemy;
 	}
 };
 
@@ -265,8 +267,8 @@ public:
 	*/
 	FFamiliarStats()
 	{
-		FactionTag = FGameplayTag::RequestGameplayTag(FName("Unit.Faction.Friendly.Familiar"));
-		RankTypeTag = FGameplayTag::RequestGameplayTag(FName("Unit.Rank.Normal"));
+		FactionTag = FParadiseGameplayTags::Get().Unit_Faction_Friendly_Familiar;
+		RankTypeTag = FParadiseGameplayTags::Get().Unit_Rank_Normal;
 	}
 
 	/** @brief 소환 코스트 (재화) */
@@ -438,6 +440,14 @@ struct FAIUnitAssets : public FUnitBaseAssets
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
 	TSoftObjectPtr<UBlackboardData> Blackboard;
 
+	/**
+	 * @brief AIPerception(시야 감지) 사용 여부
+	 * @details 기본값 false: 공간 격자 기반 경량 감지(UUnitSensingSubsystem)로 적 진영만 탐색합니다.
+	 * 시야각/청각 등 정밀한 감지가 필요한 유닛(보스 등)만 켭니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	bool bUseAIPerception = false;
+
 	// =========================================================
 	//  GAS 어빌리티 (Abilities)
 	// =========================================================
@@ -469,6 +479,14 @@ struct FAIUnitAssets : public FUnitBaseAssets
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX|Attack", meta = (Categories = "Effect.Attack"))
 	FGameplayTag BasicAttackEffectTag;
+
+	/**
+	 * @brief 원거리 평타 투사체 종류
+	 * @details 원거리 유닛이 쏘는 투사체의 비행/외형 설정 키입니다. (UProjectileConfig, 비우면 기본 종류)
+	 * 예: Projectile.Arrow, Projectile.FireBall
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Range", meta = (Categories = "Projectile"))
+	FGameplayTag ProjectileType;
 };
 
 /**
@@ -487,6 +505,14 @@ struct FEnemyAssets : public FAIUnitAssets
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX|Skill", meta = (Categories = "Effect.Skill"))
 	TArray<FGameplayTag> SkillEffectTags;
+
+	/**
+	 * @brief 배경(원거리) 표현용 프록시 메시
+	 * @details 교전 거리 밖의 대량 적은 액터 대신 이 스태틱 메시의 인스턴스(ISM)로 그려집니다. (UBackgroundUnitSubsystem)
+	 * 비어 있으면 이 행은 배경 시뮬레이션을 쓰지 않고 항상 액터로 스폰됩니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visual|Background")
+	TSoftObjectPtr<UStaticMesh> ProxyMesh;
 };
 
 /**
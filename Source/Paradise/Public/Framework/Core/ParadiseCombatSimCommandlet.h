@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ParadiseCombatSimCommandlet.generated.h"
+
+/**
+ * @class UParadiseCombatSimCommandlet
+ * @brief 기획 CSV만으로 돌리는 오프라인 전투 시뮬레이터 (밸런스 스윕용)
+ * @details
+ * - DesignData/CSVs_Export의 CharacterStats / WeaponStats / ArmorStats / SetBonusStats / EnemyStats / StageStats를 직접 읽습니다. (액터/월드/에셋 로드 없음)
+ * - 영웅 x 무기 x 방어구 세트 x 적 모든 조합을 조합당 N번 1:1로 싸움 붙이고, 조합 단위로 전 코어에 나눠 돌립니다. (ParallelFor)
+ * - 데미지는 런타임과 같은 ParadiseCombat::RollCritical / ComputeDamage(CombatFormula.h)로 계산하므로 공식이 따로 놀지 않습니다.
+ * - 조합마다 시드에서 파생한 난수 스트림을 써서, 같은 시드면 스레드 수와 상관없이 같은 결과가 나옵니다.
+ * - 출력: <Output>/CombatSim_TTK.csv (조합별 승률/TTK/DPS), <Output>/CombatSim_Stage.csv (스테이지 제한 시간 안 처치 수)
+ *
+ * 실행: UnrealEditor-Cmd Paradise.uproject -run=ParadiseCombatSim [-Fights=10000] [-Seed=1] [-Level=1] [-Multiplier=1] [-TimeCap=600] [-Input=<dir>] [-Output=<dir>]
+ *
+ * @note 장비 스탯은 현재 런타임 어트리뷰트에 반영되지 않으므로, 여기서는 캐릭터 기본값에 무기/방어구/세트 효과 수치를 그대로 더한다고 가정합니다.
+ */
+UCLASS()
+class PARADISE_API UParadiseCombatSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UParadiseCombatSimCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ParadiseTagAuditCommandlet.generated.h"
+
+/**
+ * @class UParadiseTagAuditCommandlet
+ * @brief 게임 모듈 소스에서 문자열 태그 조회(RequestGameplayTag)를 찾아내는 검사
+ * @details
+ * - 틱/어빌리티/데미지 경로에서 매번 문자열로 태그를 찾지 않도록, C++ 태그는 모두 FParadiseGameplayTags로 등록해 씁니다.
+ * - 등록 코드(ParadiseGameplayTags.cpp)를 제외한 Source/Paradise 전체에서 호출이 하나라도 있으면 실패(1)를 반환합니다. (주석 줄은 무시)
+ * 실행: UnrealEditor-Cmd Paradise.uproject -run=ParadiseTagAudit
+ */
+UCLASS()
+class PARADISE_API UParadiseTagAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UParadiseTagAuditCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -13,6 +13,7 @@ class UInputMappingContext;
 class UInputAction;
 struct FInputActionValue;
 class UInGameHUDWidget; //[추가] 26/02/04, 담당자 : 최지원 
+class USquadAIControllerComponent;
 
 /**
  * @brief 인게임 플레이어 컨트롤러
@@ -24,6 +25,8 @@ class PARADISE_API AInGameController : public APlayerController
 	GENERATED_BODY()
 
 public:
+	AInGameController();
+
 	virtual void BeginPlay() override;
 	virtual void SetupInputComponent() override;
 
@@ -76,6 +79,7 @@ private:
 
 	/*
 	 * @brief 현재 조종하지 않는 캐릭터에게 AI 컨트롤러를 빙의시키는 함수
+	 * @details 슬롯별 AI 컨트롤러(SquadAIManager)를 재사용하며 새로 생성/파괴하지 않습니다.
 	 */
 	void PossessAI(APlayerBase* TargetCharacter);
 
@@ -117,6 +121,13 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Squad")
 	TArray<TObjectPtr<APlayerBase>> ActiveSquadPawns;
 
+	/*
+	 * @brief 스쿼드 슬롯별 AI 컨트롤러 관리자
+	 * @details 교체 시 AI 컨트롤러를 생성/파괴하지 않고 빙의만 주고받습니다.
+	 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Squad")
+	TObjectPtr<USquadAIControllerComponent> SquadAIManager = nullptr;
+
 	/*
 	 * @brief 현재 내가 직접 조종 중인 영웅의 인덱스
 	 */
@@ -63,6 +63,16 @@ protected:
 	void OnPhaseResult();	///< [결과] 결과창 표시 및 레벨 이동 준비
 	/** @} */
 
+	/**
+	 * @brief 준비 카운트다운이 끝났을 때 전투 진입을 시도합니다.
+	 * @details 오브젝트 풀 예열이 아직 진행 중이면 완료될 때까지 전투 진입을 미룹니다. (Cold Pool 방지)
+	 */
+	void TryEnterCombatPhase();
+
+	/** @brief 풀 예열 완료 콜백 (준비 카운트다운 이후에도 예열 중이었던 경우) */
+	UFUNCTION()
+	void HandlePoolPrewarmCompleted();
+
 protected:
 	/** @brief [캐싱] 전역 상태 관리를 위한 GameState 포인터 */
 	UPROPERTY()
@@ -78,4 +88,24 @@ protected:
 	/** @brief [타이머] 스테이지 진행을 위한 타이머 핸들 */
 	UPROPERTY()
 	FTimerHandle StageTimerHandle;
+
+	/** @brief [이펙트] 스테이지 시작 시 비동기로 미리 로드할 전투 이펙트 데이터 (DA_GlobalFX 등) */
+	UPROPERTY(EditDefaultsOnly, Category = "FX")
+	TArray<TObjectPtr<class UFXDataAsset>> PreloadFXDataAssets;
+
+	/** @brief [AI] 유닛 AI LOD 단계 설정 (비워두면 기본 3단계 사용) */
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	TObjectPtr<class UAILODConfig> AILODConfig;
+
+	/** @brief [AI] 역할군별 군중 회피 반경/우선순위 (비워두면 모든 유닛 기본값) */
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	TObjectPtr<class UCrowdConfig> CrowdConfig;
+
+	/** @brief [AI] 스테이지 진영 적대 관계 (비워두면 태그가 다르면 적) */
+	UPROPERTY(EditDefaultsOnly, Category = "AI")
+	TObjectPtr<class UFactionConfig> FactionConfig;
+
+	/** @brief [전투] 투사체 종류별 비행/외형 설정 (비워두면 보이지 않는 기본 투사체) */
+	UPROPERTY(EditDefaultsOnly, Category = "Combat")
+	TObjectPtr<class UProjectileConfig> ProjectileConfig;
 };
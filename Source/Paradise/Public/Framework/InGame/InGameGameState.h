@@ -51,6 +51,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reward")
 	int32 AcquiredExp;
 
+	/** @brief [정보] 이번 전투의 난수 시드 (paradise.battle.Seed로 같은 전투 재현) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage Data")
+	int32 BattleSeed = 0;
+
 	/** @brief [정보] 클리어 후 이동할 다음 스테이지 ID */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage Data")
 	FName NextStageID;
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
 #include "MyAIController.generated.h"
 
 UCLASS()
@@ -18,9 +19,63 @@ public:
 	/** @brief 데이터 테이블에서 스탯을 읽어 블랙보드에 기록하는 함수 */
 	void LoadUnitStatsFromTable();
 
+	/** @brief 스포너가 이미 조회한 스탯을 블랙보드에 기록합니다. (테이블 재조회 없음) */
+	void ApplyUnitStats(const struct FAIUnitStats& InStats);
+
+#pragma region 풀 휴면 (Dormant)
+	/**
+	 * @brief 유닛이 풀로 반납될 때 호출합니다.
+	 * @details 빙의는 유지한 채 BT를 일시정지하고 이동/블랙보드/인지를 초기화합니다.
+	 * BT 노드 메모리와 블랙보드 컴포넌트가 그대로 남아 있어 재사용 시 다시 생성하지 않습니다.
+	 */
+	void EnterDormant();
+
+	/**
+	 * @brief 스폰(재사용) 시 BT를 시작합니다.
+	 * @details 휴면 상태이고 같은 BT라면 스탯/타겟 키만 다시 넣고 트리를 재시작합니다.
+	 * 그 외(첫 스폰, 다른 BT)에는 RunBehaviorTree로 새로 실행합니다.
+	 * @param InBT     실행할 비헤이비어 트리
+	 * @param InStats  (선택) 블랙보드에 넣을 스탯. nullptr이면 데이터 테이블에서 읽습니다.
+	 */
+	void StartUnitBehavior(class UBehaviorTree* InBT, const struct FAIUnitStats* InStats = nullptr);
+
+	/** @brief 풀에서 대기 중(BT 일시정지)인지 여부 */
+	bool IsDormant() const { return bDormant; }
+#pragma endregion 풀 휴면 (Dormant)
+
+#pragma region 감지 (Sensing)
+	/**
+	 * @brief 감지 방식을 선택합니다. (유닛 종류별 FAIUnitAssets::bUseAIPerception)
+	 * @details false면 AIPerception을 끄고 UUnitSensingSubsystem(격자 기반 경량 감지)에 등록합니다.
+	 */
+	void SetUseAIPerception(bool bEnable);
+
+	/**
+	 * @brief 감지 결과를 블랙보드 TargetActor에 반영합니다.
+	 * @details AIPerception(OnTargetDetected)과 격자 감지가 공통으로 사용하는 경로입니다.
+	 * @param Actor   감지/상실된 대상
+	 * @param bSensed true = 감지, false = 시야에서 벗어남
+	 */
+	void ProcessSensedActor(AActor* Actor, bool bSensed);
+
+	/** @brief 감지 반경 (시야 설정의 SightRadius) */
+	float GetSightRadius() const;
+
+	/** @brief 타겟 상실 반경 (시야 설정의 LoseSightRadius) */
+	float GetLoseSightRadius() const;
+#pragma endregion 감지 (Sensing)
+
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnPossess(APawn* InPawn) override;
 
+	/**
+	 * @brief BT의 엔진 MoveTo를 포함한 모든 이동의 경로 탐색 진입점
+	 * @details HomeBase로 향하면 공유 흐름장, 그 외에는 경로 캐시, 둘 다 실패하면 일반 경로 탐색
+	 */
+	virtual void FindPathForMoveRequest(const FAIMoveRequest& MoveRequest, FPathFindingQuery& Query, FNavPathSharedPtr& OutPath) const override;
+
 private:
 	UPROPERTY(EditAnywhere, Category = "AI")
 	class UBehaviorTree* BTAsset;
@@ -34,6 +89,28 @@ private:
 	UPROPERTY()
 	class UAISenseConfig_Sight* SightConfig;
 
+	/** @brief AIPerception 사용 여부 (false면 격자 기반 경량 감지) */
+	UPROPERTY(EditAnywhere, Category = "AI")
+	bool bUseAIPerception = false;
+
 	UFUNCTION()
 	void OnTargetDetected(AActor* Actor, FAIStimulus Stimulus);
+
+	/** @brief 스탯 이외의 타겟 관련 키를 초기값으로 되돌립니다. */
+	void ResetTargetKeys();
+
+	/** @brief 공유 목표(HomeBase)를 TargetLocation/HomeBaseActor 키에 기록합니다. */
+	void WriteGoalKeys();
+
+	/**
+	 * @brief 블랙보드 TargetActor 키에 옵저버를 겁니다.
+	 * @details 키가 바뀔 때마다 새 타겟의 사망/디스폰을 UUnitDeathEventSubsystem에 구독합니다. (BT 실행 직후 호출)
+	 */
+	void BindTargetObserver();
+
+	/** @brief TargetActor 키 변경 알림 */
+	EBlackboardNotificationResult OnTargetKeyChanged(const UBlackboardComponent& BlackboardComp, FBlackboard::FKey ChangedKeyID);
+
+	/** @brief EnterDormant 이후 아직 StartUnitBehavior가 호출되지 않은 상태 */
+	bool bDormant = false;
 };
\ No newline at end of file
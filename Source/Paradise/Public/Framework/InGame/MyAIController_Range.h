@@ -14,6 +14,12 @@ class PARADISE_API AMyAIController_Range : public AAIController
 protected:
 	virtual void OnPossess(APawn* InPawn) override;
 
+	/**
+	 * @brief BT의 엔진 MoveTo를 포함한 모든 이동의 경로 탐색 진입점
+	 * @details HomeBase로 향하면 공유 흐름장, 그 외에는 경로 캐시, 둘 다 실패하면 일반 경로 탐색
+	 */
+	virtual void FindPathForMoveRequest(const FAIMoveRequest& MoveRequest, FPathFindingQuery& Query, FNavPathSharedPtr& OutPath) const override;
+
 public:
 	UPROPERTY(EditAnywhere, Category = "AI")
 	class UBehaviorTree* BTAsset;
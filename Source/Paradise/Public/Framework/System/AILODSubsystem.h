@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Data/Structs/AILODStructs.h"
+#include "AILODSubsystem.generated.h"
+
+class ABaseUnit;
+class UAILODConfig;
+class UBehaviorTreeComponent;
+
+/**
+ * @class UAILODSubsystem
+ * @brief 카메라/전선과의 거리에 따라 유닛별 AI 갱신 주기를 단계적으로 낮추는 월드 서브시스템
+ * @details 매 프레임 일부 유닛(paradise.ai.lod.UnitsPerFrame)만 돌아가며 단계를 다시 계산합니다.
+ * - 조건: 카메라 거리(+ WasRecentlyRendered) 또는 가장 가까운 적과의 거리 (UUnitSpatialGridSubsystem)
+ * - 적용: BT 서비스 간격 배율, 컨트롤러/무브먼트/메시 틱 간격, VisibilityBasedAnimTickOption
+ * - 덜 정밀한 단계로 내려갈 때만 HysteresisScale만큼 조건을 넓혀 깜빡임을 막습니다.
+ * 단계별 유닛 수는 'stat ParadiseAILOD'로 확인합니다.
+ */
+UCLASS()
+class PARADISE_API UAILODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 단계 설정을 교체합니다. (nullptr이면 기본 3단계) */
+	void SetConfig(const UAILODConfig* InConfig);
+
+	/** @brief 유닛의 단계를 즉시 0(가장 정밀)으로 되돌립니다. (풀 재사용 시) */
+	void ResetUnit(ABaseUnit* Unit);
+
+	/**
+	 * @brief BT 서비스 간격에 곱할 배율
+	 * @details 서비스의 TickNode에서 다음 실행 시점을 늦출 때 사용합니다. 단계 0이거나 유닛이 아니면 1입니다.
+	 */
+	static float GetServiceIntervalScale(const UBehaviorTreeComponent& OwnerComp);
+
+private:
+	/** @brief 유닛 하나의 단계를 다시 계산합니다. */
+	int32 EvaluateTier(const ABaseUnit* Unit, const class UUnitSpatialGridSubsystem* Grid, const FVector& ViewLocation, bool bHasView) const;
+
+	/** @brief 단계 조건 검사 (Scale: 히스테리시스 배율) */
+	bool QualifiesForTier(int32 TierIndex, float ViewDistSq, bool bRendered, float FrontLineDist, float Scale) const;
+
+	/** @brief 단계 설정을 유닛의 컴포넌트에 적용합니다. */
+	void ApplyTier(ABaseUnit* Unit, int32 TierIndex) const;
+
+	/** @brief 기본 단계 (근접/중간/원거리) */
+	void BuildDefaultTiers();
+
+	TArray<FAILODTierSettings> Tiers;
+
+	float HysteresisScale = 1.2f;
+
+	/** @brief 전선 거리 검색 반경 (모든 단계의 MaxFrontLineDistance 최댓값 × 히스테리시스) */
+	float FrontLineSearchRadius = 0.f;
+
+	/** @brief 단계를 한 번이라도 적용했는지 (LOD를 끌 때 원복용) */
+	bool bTiersApplied = false;
+
+	/** @brief 라운드 로빈 평가 위치 (그리드 항목 인덱스) */
+	int32 EvaluateCursor = 0;
+};
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AIWorkSchedulerSubsystem.generated.h"
+
+class UBehaviorTreeComponent;
+class IParadiseScheduledAIWork;
+
+/** @brief 예약된 AI 작업 한 건 */
+struct FScheduledAIWorkItem
+{
+	TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp;
+
+	/** @brief 작업 노드 (BT 에셋의 노드 템플릿) */
+	TWeakObjectPtr<UObject> WorkObject;
+	IParadiseScheduledAIWork* Work = nullptr;
+
+	/** @brief 중복 예약 방지 키 (객체가 사라진 뒤에도 지울 수 있도록 보관) */
+	TObjectKey<UBehaviorTreeComponent> OwnerKey;
+	TObjectKey<UObject> WorkKey;
+
+	/** @brief 예약 시각 (대기 시간 통계/기아 판정용) */
+	double EnqueueTime = 0.0;
+
+	/** @brief 교전 중(블랙보드 타겟 보유) 유닛의 작업이면 먼저 실행 */
+	bool bCombat = false;
+};
+
+/**
+ * @class UAIWorkSchedulerSubsystem
+ * @brief BT 서비스/태스크의 무거운 작업을 프레임당 ms 예산 안에서 나눠 실행하는 월드 서브시스템
+ * @details 웨이브 스폰 직후 모든 유닛의 서비스가 같은 프레임에 몰려 생기는 스파이크를 없앱니다.
+ * - 실행 순서: 기아(StarvationSeconds 이상 대기) → 교전 중 → 일반, 각 그룹 안에서는 예약 순서(라운드 로빈)
+ * - 기아 작업은 예산을 넘겨도 실행해 대기 시간 상한을 보장합니다.
+ * - (BT 컴포넌트, 노드) 쌍당 한 건만 큐에 유지합니다.
+ * 예산은 paradise.ai.scheduler.BudgetMs, 통계는 'stat ParadiseAIScheduler'로 확인합니다.
+ */
+UCLASS()
+class PARADISE_API UAIWorkSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 스케줄러 사용 여부 (paradise.ai.scheduler.Enable) */
+	static bool IsEnabled();
+
+	/**
+	 * @brief 작업을 예약합니다. 같은 (OwnerComp, Work) 쌍이 이미 대기 중이면 무시합니다.
+	 * @param Work 작업을 수행할 노드 (IParadiseScheduledAIWork를 구현한 UObject)
+	 * @return 새로 예약했으면 true
+	 */
+	bool Enqueue(UBehaviorTreeComponent& OwnerComp, UObject* Work);
+
+	/** @brief 대기 중인 작업을 취소합니다. (태스크 중단 시) */
+	void Cancel(const UBehaviorTreeComponent& OwnerComp, const UObject* Work);
+
+	/** @brief 현재 대기 중인 작업 수 */
+	int32 GetNumPending() const { return Queue.Num(); }
+
+private:
+	using FWorkKey = TPair<TObjectKey<UBehaviorTreeComponent>, TObjectKey<UObject>>;
+
+	/** @brief 교전 중 판정 (블랙보드 TargetActor 보유) */
+	static bool IsInCombat(const UBehaviorTreeComponent& OwnerComp);
+
+	/**
+	 * @brief 대기열의 작업 한 건을 실행합니다.
+	 * @return BT가 일시정지 상태라 미뤄야 하면 false (대기열에 남김)
+	 */
+	bool ExecuteAt(int32 QueueIndex, double Now);
+
+	/** @brief 예약 순서대로 쌓인 대기열 */
+	TArray<FScheduledAIWorkItem> Queue;
+
+	/** @brief 중복 예약 방지 */
+	TSet<FWorkKey> PendingKeys;
+
+	/** @brief 이번 프레임 실행 통계 (ExecuteAt에서 누적) */
+	int32 ExecutedThisFrame = 0;
+	double StalenessSumThisFrame = 0.0;
+	double MaxStalenessThisFrame = 0.0;
+};
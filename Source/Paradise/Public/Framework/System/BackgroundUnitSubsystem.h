@@ -0,0 +1,176 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Data/Structs/UnitStructs.h"
+#include "Framework/System/ObjectPoolSubsystem.h"
+#include "BackgroundUnitSubsystem.generated.h"
+
+class ABaseUnit;
+class UDataTable;
+class UInstancedStaticMeshComponent;
+
+/**
+ * @brief 배경 유닛의 종류 한 개 (유닛 클래스 + 데이터 테이블 행)
+ * @details 같은 FEnemyStats/FEnemyAssets 행을 액터 스폰과 배경 시뮬레이션이 함께 사용합니다.
+ */
+USTRUCT()
+struct FBackgroundUnitArchetype
+{
+	GENERATED_BODY()
+
+	/** @brief 승격 시 풀에서 꺼낼 클래스 */
+	UPROPERTY()
+	TSubclassOf<ABaseUnit> UnitClass;
+
+	UPROPERTY()
+	TObjectPtr<UDataTable> StatsTable = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UDataTable> AssetsTable = nullptr;
+
+	FName RowName;
+
+	/** @brief 테이블 행 (테이블이 살아 있는 동안 유효) */
+	FEnemyStats* Stats = nullptr;
+	FEnemyAssets* Assets = nullptr;
+
+	/** @brief 프록시 메시 인스턴스 (종류당 1개) */
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+
+	FPoolClassHandle PoolHandle;
+	uint8 FactionId = 0;
+	float MoveSpeed = 0.f;
+	float Scale = 1.f;
+
+	/** @brief 프레임마다 재사용하는 인스턴스 트랜스폼 버퍼 */
+	TArray<FTransform> InstanceTransforms;
+};
+
+/**
+ * @brief 배경 유닛 전체의 SoA 데이터
+ * @details 같은 인덱스가 한 유닛입니다. 제거는 마지막 항목과 교체(RemoveAtSwap)합니다.
+ */
+struct FBackgroundUnitArray
+{
+	/** @brief 발 위치 (지면 높이) */
+	TArray<FVector> Location;
+	TArray<float> Yaw;
+	TArray<float> HP;
+	TArray<uint8> FactionId;
+	TArray<uint16> Archetype;
+
+	/** @brief 이동 목표 (흐름장을 벗어났을 때 직진 목표) */
+	TArray<FVector> TargetLocation;
+
+	int32 Num() const { return Location.Num(); }
+
+	int32 Add(const FVector& InLocation, float InYaw, float InHP, uint8 InFactionId, uint16 InArchetype, const FVector& InTarget);
+	void RemoveAtSwap(int32 Index);
+	void Reset();
+};
+
+/** @brief 액터로 승격된 배경 유닛 */
+struct FPromotedBackgroundUnit
+{
+	TWeakObjectPtr<ABaseUnit> Unit;
+	uint16 Archetype = 0;
+	FVector TargetLocation = FVector::ZeroVector;
+};
+
+/**
+ * @class UBackgroundUnitSubsystem
+ * @brief 대량 적 스테이지에서 교전 거리 밖의 적을 액터 없이 시뮬레이션하는 월드 서브시스템
+ * @details
+ * - 멀리 있는 적은 위치/HP/진영/목표만 SoA로 들고, 흐름장(UFlowFieldSubsystem)을 따라 이동하며
+ *   FEnemyAssets::ProxyMesh의 인스턴스(ISM)로 그려집니다. 컨트롤러/BT/캐릭터 무브먼트 비용이 없습니다.
+ * - 스쿼드(적대 진영의 격자 유닛, HomeBase 포함)나 카메라의 교전 거리 안으로 들어오면
+ *   오브젝트 풀에서 ABaseUnit을 꺼내 같은 데이터 행으로 초기화합니다. (승격)
+ * - 승격된 유닛이 다시 멀어지면 HP/위치를 넘겨받고 액터는 풀로 반납합니다. (강등, 거리 히스테리시스 적용)
+ * - 배경 유닛은 격자에 등록되지 않으므로 타게팅/감지 대상이 아닙니다. 전투는 항상 액터로 처리됩니다.
+ * 통계: 'stat ParadiseBackground', 상태: paradise.ai.background.Dump
+ */
+UCLASS()
+class PARADISE_API UBackgroundUnitSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 배경 시뮬레이션 사용 여부 (paradise.ai.background.Enable) */
+	static bool IsEnabled();
+
+	/**
+	 * @brief 배경 유닛을 추가합니다.
+	 * @details 교전 거리 안이면 다음 Tick에서 바로 승격됩니다.
+	 * @return 행이 없거나 ProxyMesh가 비어 있으면 false (호출 측에서 액터로 스폰)
+	 */
+	bool AddUnit(TSubclassOf<ABaseUnit> UnitClass, UDataTable* StatsTable, UDataTable* AssetsTable, FName RowName, const FVector& Location, float Yaw);
+
+	/** @brief 배경 유닛을 모두 제거합니다. (승격된 액터는 그대로 둠) */
+	void ClearUnits();
+
+	int32 GetNumBackgroundUnits() const { return Units.Num(); }
+	int32 GetNumPromotedUnits() const { return Promoted.Num(); }
+
+	/** @brief 현재 상태를 로그로 출력합니다. */
+	void DumpState() const;
+
+private:
+	/** @brief (클래스, 테이블, 행)의 종류 인덱스 (없으면 만듦, 실패 시 INDEX_NONE) */
+	int32 FindOrAddArchetype(TSubclassOf<ABaseUnit> UnitClass, UDataTable* StatsTable, UDataTable* AssetsTable, FName RowName);
+
+	/** @brief 흐름장/목표 방향으로 이동 */
+	void SimulateMovement(float DeltaTime);
+
+	/** @brief 교전 거리 판정 기준점(스쿼드)을 셀 해시로 모읍니다. */
+	void GatherFocusPoints();
+
+	/** @brief 위치가 교전 거리(Scale 배) 안인지 */
+	bool IsNearFocus(const FVector& Location, uint8 FactionId, float Scale) const;
+
+	void UpdateDemotions();
+	void UpdatePromotions();
+
+	/** @brief 배경 유닛 → 풀 액터 */
+	ABaseUnit* PromoteUnit(int32 Index);
+
+	/** @brief 승격된 액터 → 배경 유닛 (액터는 풀로 반납) */
+	void DemoteUnit(int32 PromotedIndex);
+
+	/** @brief 종류별 ISM 인스턴스 갱신 */
+	void UpdateInstances();
+
+	/** @brief ISM을 붙여둘 액터 (처음 필요할 때 생성) */
+	AActor* GetOrCreateInstanceOwner();
+
+	UPROPERTY()
+	TArray<FBackgroundUnitArchetype> Archetypes;
+
+	UPROPERTY()
+	TObjectPtr<AActor> InstanceOwner = nullptr;
+
+	FBackgroundUnitArray Units;
+	TArray<FPromotedBackgroundUnit> Promoted;
+
+	/** @brief 스쿼드 위치 셀 해시 (셀 크기 = 강등 거리) */
+	struct FFocusPoint
+	{
+		FVector Location;
+		uint8 FactionId;
+	};
+	TMap<int64, TArray<FFocusPoint>> FocusCells;
+	float FocusCellSize = 1.f;
+
+	FVector CameraLocation = FVector::ZeroVector;
+	bool bHasCamera = false;
+
+	/** @brief 프레임마다 나눠서 승격 검사를 이어가는 위치 */
+	int32 PromoteCursor = 0;
+};
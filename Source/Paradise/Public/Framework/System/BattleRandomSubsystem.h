@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Math/RandomStream.h"
+#include "BattleRandomSubsystem.generated.h"
+
+/**
+ * @brief 전투 난수 하위 스트림
+ * @details 스트림을 용도별로 나눠서, 한쪽 호출 횟수가 바뀌어도 다른 쪽 결과가 밀리지 않게 합니다.
+ */
+enum class EBattleRandomStream : uint8
+{
+	Crit,			// 치명타 판정 (ExecCalcCombat, 데미지 큐)
+	SpawnPosition,	// 적 스폰 위치/방향 (UnitSpawner)
+	SummonShop,		// 소환 상점 슬롯 (FamiliarSummonComponent)
+
+	Count
+};
+
+/**
+ * @class UBattleRandomSubsystem
+ * @brief 전투(스테이지) 단위로 시드를 고정하는 난수 서비스
+ * @details
+ * - 월드(스테이지)가 시작될 때 시드를 정하고, 하위 스트림마다 시드에서 파생한 FRandomStream을 씁니다.
+ * - 같은 시드 + 같은 입력이면 치명타/스폰 위치/상점 목록이 똑같이 나오므로, 성능 회귀 비교 때 같은 전투를 재현할 수 있습니다.
+ * - 월드마다 따로 가지며 게임 스레드에서만 씁니다. (락/전역 상태 없음)
+ * - 시드 지정: paradise.battle.Seed N (0 = 시간 기반). 정해진 시드는 로그, GameState(BattleSeed), CSV 프로파일 메타데이터에 남습니다.
+ */
+UCLASS()
+class PARADISE_API UBattleRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** @brief 월드 시작 시 시드 결정 (액터 BeginPlay보다 먼저 불림) */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/**
+	 * @brief 모든 하위 스트림을 시드로 다시 초기화합니다.
+	 * @param InSeed 전투 시드 (스트림별 시드는 여기서 파생)
+	 */
+	void StartBattle(int32 InSeed);
+
+	/** @brief 하위 스트림 (게임 스레드 전용) */
+	FRandomStream& GetStream(EBattleRandomStream Stream) { return Streams[static_cast<uint8>(Stream)]; }
+
+	/** @brief 이번 전투 시드 */
+	int32 GetSeed() const { return Seed; }
+
+	/**
+	 * @brief 월드 컨텍스트에서 하위 스트림을 찾습니다. (GAS 실행 계산처럼 서브시스템을 직접 들고 있지 않은 곳용)
+	 * @return 월드가 없으면 nullptr (호출부에서 FMath 난수로 대체)
+	 */
+	static FRandomStream* FindStream(const UObject* WorldContextObject, EBattleRandomStream Stream);
+
+protected:
+	/** @brief CVar 시드, 없으면 시간 기반 시드 */
+	static int32 ResolveSeed();
+
+private:
+	FRandomStream Streams[static_cast<uint8>(EBattleRandomStream::Count)];
+
+	int32 Seed = 0;
+};
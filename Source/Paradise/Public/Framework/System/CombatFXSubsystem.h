@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "CombatFXSubsystem.generated.h"
+
+class UFXDataAsset;
+class UNiagaraComponent;
+struct FStreamableHandle;
+
+/**
+ * @class UCombatFXSubsystem
+ * @brief 전투 이펙트(VFX/SFX) 재생을 담당하는 월드 서브시스템
+ * @details UFXDataAsset::EffectMap을 기준으로 동작합니다.
+ * - 스테이지 시작 시 EffectMap이 참조하는 모든 에셋을 비동기로 미리 로드합니다. (재생 시 동기 로드 없음)
+ * - 아직 로드되지 않은 이펙트는 이번 재생을 건너뜁니다. (히치 대신 이펙트 1회 누락)
+ * - 나이아가라는 컴포넌트 풀(ENCPoolMethod::AutoRelease)로 재사용합니다.
+ * - 태그별 동시 재생 수(FCombatFXSet::MaxConcurrent)와 프레임당 생성 수(paradise.fx.MaxSpawnsPerFrame)를 제한합니다.
+ * - 사운드는 카메라 거리로 컬링하고, 데이터 에셋의 SoundConcurrency로 동시 재생 수를 제한합니다.
+ * 통계는 'stat ParadiseFX'로 확인할 수 있습니다.
+ */
+UCLASS()
+class PARADISE_API UCombatFXSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief 데이터 에셋이 참조하는 VFX/SFX를 비동기로 미리 로드합니다.
+	 * @details 같은 에셋을 여러 번 요청해도 1회만 로드합니다. 로드된 에셋은 월드가 내려갈 때까지 유지됩니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "CombatFX")
+	void PreloadFXData(UFXDataAsset* FXData);
+
+	/** @brief 요청된 모든 프리로드가 끝났는지 여부 */
+	UFUNCTION(BlueprintPure, Category = "CombatFX")
+	bool IsPreloadComplete() const;
+
+	/**
+	 * @brief 태그에 해당하는 이펙트를 재생합니다.
+	 * @param FXData   검색할 데이터 에셋
+	 * @param Tag      이펙트 태그 (예: Effect.Hit.Sword)
+	 * @param Location 재생 위치
+	 * @return 데이터 에셋에 태그가 등록되어 있으면 true (예산/로드 상태로 생략된 경우 포함)
+	 */
+	bool PlayCombatFX(UFXDataAsset* FXData, const FGameplayTag& Tag, const FVector& Location);
+
+private:
+	/** @brief 프레임당 생성 예산을 하나 사용합니다. 예산이 없으면 false */
+	bool ConsumeFrameBudget();
+
+	/** @brief 태그별 동시 재생 수 제한 검사 (끝난 컴포넌트는 정리) */
+	bool HasConcurrencySlot(const FGameplayTag& Tag, int32 MaxConcurrent);
+
+	/**
+	 * @brief 새로 재생한 컴포넌트를 태그 목록에 올립니다.
+	 * @details 풀에서 재사용된 컴포넌트는 아직 정리되지 않은 이전 태그 목록에서 먼저 빼므로, 컴포넌트 하나는 한 번만 집계됩니다.
+	 * @param bCounted 이 태그가 동시 재생 수 제한을 쓰는지 여부
+	 */
+	void TrackActiveEffect(UNiagaraComponent* NiagaraComp, const FGameplayTag& Tag, bool bCounted);
+
+	/** @brief 프리로드가 요청된 데이터 에셋 */
+	TSet<TObjectKey<UFXDataAsset>> PreloadedData;
+
+	/** @brief 로드된 에셋을 붙잡아두는 핸들 */
+	TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+	/** @brief 태그별 재생 중인 나이아가라 컴포넌트 (풀로 돌아가면 비활성) */
+	TMap<FGameplayTag, TArray<TWeakObjectPtr<UNiagaraComponent>>> ActiveEffects;
+
+	/** @brief ActiveEffects에 올라간 컴포넌트가 어느 태그 목록에 있는지 (컴포넌트당 1개) */
+	TMap<TWeakObjectPtr<UNiagaraComponent>, FGameplayTag> EffectOwnerTags;
+
+	/** @brief 프레임당 생성 수 카운트 */
+	uint64 BudgetFrame = 0;
+	int32 SpawnsThisFrame = 0;
+};
@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "Data/Structs/CrowdStructs.h"
+#include "AI/CrowdAvoidanceSolver.h"
+#include "CrowdSubsystem.generated.h"
+
+class ABaseUnit;
+class UCrowdConfig;
+
+/**
+ * @brief 군중 회피 모드 유닛 캡슐의 오브젝트 채널 (DefaultEngine.ini의 "CrowdUnit")
+ * @details CrowdUnit끼리는 서로 무시하고, 플레이어/지형/ECC_Pawn 트레이스에는 그대로 막힙니다.
+ */
+static constexpr ECollisionChannel ECC_CrowdUnit = ECC_GameTraceChannel1;
+
+/**
+ * @class UCrowdSubsystem
+ * @brief AI 유닛끼리의 캡슐 충돌 대신 배치 계산된 군중 분리/회피로 밀집 이동을 처리하는 월드 서브시스템
+ * @details
+ * - 유닛 간 Pawn 충돌을 끄고(CrowdUnit 채널), 매 프레임 공간 격자에 등록된 유닛을 스냅샷으로 모아
+ *   FCrowdAvoidanceSolver로 한 번에 계산합니다.
+ * - 결과: 겹침은 위치 보정, 곧 부딪힐 이웃은 속도 방향 보정 (CharacterMovement가 다음 프레임에 이어받음)
+ * - 반경/우선순위는 역할군(ABaseUnit::RoleTypeTag)별로 UCrowdConfig에서 설정합니다.
+ * 부하 측정: paradise.crowd.stress N, 통계: 'stat ParadiseCrowd'
+ */
+UCLASS()
+class PARADISE_API UCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 군중 회피 사용 여부 (paradise.crowd.Enable) */
+	static bool IsEnabled();
+
+	/** @brief 역할군별 설정을 교체합니다. (nullptr이면 모든 유닛 기본값) */
+	void SetConfig(const UCrowdConfig* InConfig);
+
+	/** @brief 역할군의 반경/우선순위 */
+	const FCrowdAgentSettings& GetAgentSettings(const FGameplayTag& RoleTag) const;
+
+	/**
+	 * @brief 현재 모드에 맞게 유닛 캡슐의 충돌 채널을 설정합니다.
+	 * @details 켜져 있으면 CrowdUnit 채널(유닛끼리 무시), 꺼져 있으면 기본 Pawn 충돌. 움직이지 않는 유닛(HomeBase)은 건드리지 않습니다.
+	 */
+	void ApplyCrowdCollision(ABaseUnit* Unit) const;
+
+#pragma region 부하 측정
+public:
+	/** @brief 플레이어 주변에 유닛 Count개를 스폰해 한 점으로 몰리게 합니다. (0이면 정리) */
+	void StartStressTest(int32 Count);
+
+	void StopStressTest();
+#pragma endregion 부하 측정
+
+private:
+	/** @brief 모드(CVar)가 바뀌었으면 등록된 유닛 전체의 충돌을 다시 설정 */
+	void SyncCollisionMode();
+
+	/** @brief 스트레스 유닛이 멈추면 다시 중심으로 이동 */
+	void TickStressTest();
+
+	FCrowdAgentSettings DefaultSettings;
+	TMap<FGameplayTag, FCrowdAgentSettings> RoleSettings;
+
+	/** @brief 마지막으로 적용한 충돌 모드 */
+	bool bCollisionModeApplied = false;
+
+	/** @brief 프레임마다 재사용하는 스냅샷/결과 (할당 재사용) */
+	FCrowdAgentSnapshot Snapshot;
+	FCrowdAvoidanceResults Results;
+
+	/** @brief 스냅샷 슬롯 → 유닛 (Tick 안에서만 유효) */
+	TArray<ABaseUnit*> SnapshotUnits;
+
+	TArray<TWeakObjectPtr<ABaseUnit>> StressUnits;
+	FVector StressCenter = FVector::ZeroVector;
+};
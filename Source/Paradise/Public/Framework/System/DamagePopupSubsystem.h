@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "DamagePopupSubsystem.generated.h"
+
+class SDamagePopupLayer;
+
+/** @brief 링 버퍼에 보관되는 데미지 숫자 한 개 */
+struct FDamagePopupEntry
+{
+	/** @brief 숫자가 떠오르기 시작하는 월드 위치 (대상 머리 위) */
+	FVector WorldLocation = FVector::ZeroVector;
+
+	/** @brief 같은 프레임 합산 판단용 대상 */
+	TObjectKey<AActor> Target;
+
+	/** @brief 표시할 텍스트 (생성/합산 시에만 포맷) */
+	FString Text;
+
+	float Damage = 0.f;
+
+	/** @brief 생성 후 경과 시간 (초) */
+	float Age = 0.f;
+
+	/** @brief 화면 기준 좌우 흩뿌림 (겹침 방지) */
+	float JitterX = 0.f;
+
+	/** @brief Text의 픽셀 너비 (가운데 정렬용, 포맷 시 1회 측정) */
+	float TextWidth = 0.f;
+
+	/** @brief 생성된 프레임 번호 (같은 프레임 피격 합산용) */
+	uint64 SpawnFrame = 0;
+
+	bool bCritical = false;
+
+	/** @brief 링 버퍼에서 사용 중인 칸인지 여부 */
+	bool bActive = false;
+};
+
+/** @brief 이번 프레임에 그릴 항목 (Tick에서 투영까지 끝낸 결과) */
+struct FDamagePopupDrawItem
+{
+	FVector2D Position = FVector2D::ZeroVector;
+	int32 EntryIndex = INDEX_NONE;
+	float Alpha = 1.f;
+	float Scale = 1.f;
+};
+
+/**
+ * @class UDamagePopupSubsystem
+ * @brief 피격 데미지 숫자를 월드 단위로 모아서 그리는 서브시스템
+ * @details 피격마다 액터/위젯을 만들지 않고, 고정 크기 링 버퍼에 숫자를 쌓은 뒤
+ * 뷰포트에 올린 Slate 레이어 하나가 한 번의 OnPaint로 전부 그립니다.
+ * - 같은 프레임에 같은 대상이 여러 번 맞으면 숫자 하나로 합산합니다.
+ * - 버퍼가 가득 차면 가장 오래된 숫자를 덮어씁니다. (paradise.popup.MaxCount)
+ * - 치명타는 ExecCalcCombat에서 전달받아 크기/색상을 다르게 표시합니다.
+ * 통계는 'stat ParadisePopup'으로 확인할 수 있습니다.
+ */
+UCLASS()
+class PARADISE_API UDamagePopupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief 데미지 숫자를 추가합니다.
+	 * @details 같은 프레임에 같은 대상으로 들어온 요청은 기존 숫자에 합산됩니다.
+	 * @param Target      맞은 액터 (머리 위에 표시)
+	 * @param DamageAmount 표시할 데미지
+	 * @param bIsCritical 치명타 여부 (합산 시 하나라도 치명타면 치명타로 표시)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DamagePopup")
+	void AddDamagePopup(AActor* Target, float DamageAmount, bool bIsCritical);
+
+	/** @brief Slate 레이어가 그릴 항목 목록 */
+	const TArray<FDamagePopupDrawItem>& GetDrawItems() const { return DrawItems; }
+
+	/** @brief 그릴 항목이 참조하는 원본 숫자 */
+	const FDamagePopupEntry& GetEntry(int32 EntryIndex) const { return Entries[EntryIndex]; }
+
+	/** @brief 그릴 항목의 인덱스가 현재 링 버퍼 안에 있는지 (용량 변경 직후 대비) */
+	bool IsValidEntryIndex(int32 EntryIndex) const { return Entries.IsValidIndex(EntryIndex); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** @brief 뷰포트에 Slate 레이어를 올립니다. (첫 숫자가 들어올 때 1회) */
+	bool EnsureLayer();
+
+	/** @brief 숫자 텍스트와 너비를 갱신합니다. */
+	static void FormatEntry(FDamagePopupEntry& Entry);
+
+	/** @brief 링 버퍼 (용량 = paradise.popup.MaxCount) */
+	TArray<FDamagePopupEntry> Entries;
+
+	/** @brief 다음에 덮어쓸 위치 */
+	int32 Head = 0;
+
+	/** @brief 현재 살아있는 숫자 개수 */
+	int32 NumAlive = 0;
+
+	/** @brief 이번 프레임에 생성된 대상별 숫자 위치 (같은 프레임 합산용) */
+	TMap<TObjectKey<AActor>, int32> FrameMergeMap;
+
+	/** @brief FrameMergeMap이 유효한 프레임 번호 */
+	uint64 FrameMergeFrame = 0;
+
+	TArray<FDamagePopupDrawItem> DrawItems;
+
+	TSharedPtr<SDamagePopupLayer> Layer;
+};
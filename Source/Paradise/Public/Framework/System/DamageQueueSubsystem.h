@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "GAS/Calculations/CombatFormula.h"
+#include "DamageQueueSubsystem.generated.h"
+
+class ABaseUnit;
+
+/**
+ * @brief 데미지 기록 한 건 (공격 시점의 공격자 스탯을 담아둠)
+ */
+struct FDamageRecord
+{
+	/** @brief 공격자 (Instigator, 해결 시점에 이미 죽었을 수 있음) */
+	TWeakObjectPtr<AActor> Source;
+	TWeakObjectPtr<ABaseUnit> Target;
+
+	float AttackPower = 0.f;
+	float Multiplier = 1.f;
+	float CritRate = 0.f;
+	float CritDamage = ParadiseCombat::DefaultCritDamage;
+
+	/** @brief 피해 종류 (연출/UI용, OnUnitDamaged로 전달) */
+	FGameplayTag DamageTag;
+};
+
+/**
+ * @brief 한 프레임 동안 한 대상에게 들어온 데미지 합계가 적용된 뒤 호출됩니다.
+ * @param Target     피해자
+ * @param Instigator 가장 큰 한 방을 넣은 공격자
+ * @param Damage     합산 데미지
+ * @param DamageTag  가장 큰 한 방의 피해 종류
+ */
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnUnitDamaged, ABaseUnit* /*Target*/, AActor* /*Instigator*/, float /*Damage*/, const FGameplayTag& /*DamageTag*/);
+
+/**
+ * @class UDamageQueueSubsystem
+ * @brief AI 유닛 간 데미지를 프레임 단위로 모아 한 번에 적용하는 월드 서브시스템
+ * @details
+ * - 공격(BTTask_Attack, 투사체)은 PostAttack/PostDamage로 기록만 남기고 즉시 TakeDamage를 호출하지 않습니다.
+ * - 모든 액터 틱(AI 패스)이 끝난 뒤(OnWorldPostActorTick) 한 번에 해결합니다.
+ *   1) 게시 순서대로 대상별 합산 (공식: CombatFormula.h, 피해자 방어력은 유닛 캐시 스탯)
+ *   2) 대상별 HP 반영
+ *   3) 모든 HP 반영이 끝난 뒤 사망 처리(Die → 풀 반납)
+ * - BT 실행 도중 풀 반납이 일어나지 않고, 같은 입력이면 같은 순서로 처리됩니다.
+ * 통계: 'stat ParadiseDamage'
+ */
+UCLASS()
+class PARADISE_API UDamageQueueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** @brief 데미지 기록을 게시합니다. (이번 프레임 끝에 적용) */
+	void PostDamage(const FDamageRecord& Record);
+
+	/**
+	 * @brief 공격자의 캐시 스탯(공격력/치명타)으로 데미지를 게시합니다.
+	 * @param Multiplier 스킬/평타 배율 (평타 = 1)
+	 */
+	void PostAttack(ABaseUnit* Source, ABaseUnit* Target, float Multiplier = 1.f, const FGameplayTag& DamageTag = FGameplayTag());
+
+	/** @brief 대상별 합산 데미지가 적용될 때마다 호출됩니다. */
+	FOnUnitDamaged OnUnitDamaged;
+
+	int32 GetNumPendingRecords() const { return Records.Num(); }
+
+private:
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** @brief 이번 프레임 기록을 대상별로 합산 → HP 반영 → 사망 처리 */
+	void ResolvePendingDamage();
+
+	/** @brief 한 대상의 이번 프레임 합계 */
+	struct FAggregatedDamage
+	{
+		ABaseUnit* Target = nullptr;
+		AActor* Instigator = nullptr;
+		float Damage = 0.f;
+		float LargestHit = 0.f;
+		FGameplayTag DamageTag;
+		bool bCritical = false;
+	};
+
+	TArray<FDamageRecord> Records;
+
+	/** @brief 해결 중에만 쓰는 버퍼 (할당 재사용) */
+	TArray<FAggregatedDamage> Aggregated;
+	TMap<ABaseUnit*, int32> AggregatedIndex;
+	TArray<ABaseUnit*> Deaths;
+
+	FDelegateHandle PostActorTickHandle;
+};
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "FlowFieldSubsystem.generated.h"
+
+class ABaseUnit;
+class AHomeBase;
+class ANavigationData;
+class AAIController;
+class UBlackboardComponent;
+struct FAIMoveRequest;
+struct FPathFindingQuery;
+
+/**
+ * @struct FFlowFieldData
+ * @brief HomeBase까지의 거리장(Distance Field)과 셀별 이동 방향
+ * @details 목표 주변 정사각형 영역을 CellSize 간격으로 나눈 2D 격자입니다. (인덱스 = Y * SizeX + X)
+ */
+struct FFlowFieldData
+{
+	/** @brief 격자 (0, 0) 셀의 최소 모서리 */
+	FVector Origin = FVector::ZeroVector;
+
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	float CellSize = 200.f;
+
+	/** @brief 셀 중심을 네비메시에 투영한 높이 */
+	TArray<float> Height;
+
+	/** @brief 네비메시 위 셀 여부 */
+	TArray<bool> Walkable;
+
+	/** @brief 목표까지의 경로 비용 (도달 불가 = MAX_flt) */
+	TArray<float> Cost;
+
+	/** @brief 셀에서 다음 셀로 향하는 정규화된 2D 방향 */
+	TArray<FVector2f> Direction;
+
+	FIntPoint GoalCell = FIntPoint::ZeroValue;
+
+	int32 Num() const { return SizeX * SizeY; }
+	bool IsValid() const { return Num() > 0; }
+	int32 ToIndex(int32 X, int32 Y) const { return Y * SizeX + X; }
+	bool IsInside(int32 X, int32 Y) const { return X >= 0 && Y >= 0 && X < SizeX && Y < SizeY; }
+	FVector GetCellCenter(int32 X, int32 Y) const;
+
+	/** @brief 위치가 속한 셀 (격자 밖이면 false) */
+	bool ToCell(const FVector& Location, int32& OutX, int32& OutY) const;
+};
+
+/**
+ * @class UFlowFieldSubsystem
+ * @brief 호드 적이 HomeBase로 이동할 때 개별 경로 탐색 대신 공유 흐름장(Flow Field)을 따르게 하는 서브시스템
+ * @details
+ * - 스테이지 시작(HomeBase::BeginPlay) 시 한 번, 네비메시가 다시 생성될 때마다 프레임을 나눠 재계산합니다.
+ *   (투영 → 다익스트라 → 방향 순서, 계산 중에는 이전 흐름장을 계속 사용)
+ * - BTTask_MoveToTarget이 목표가 HomeBase일 때 StartFollowing으로 유닛을 맡기고,
+ *   이 서브시스템이 매 프레임 AddMovementInput으로 조향합니다.
+ * - BT의 엔진 MoveTo(HomeBase 접근)는 AI 컨트롤러의 FindPathForMoveRequest에서 FindFlowPath로 흐름장 경로를 받습니다. (개별 A* 없음)
+ * - 블랙보드 TargetActor가 생기면(유닛 교전) 흐름 모드를 해제하고 BT/일반 경로 탐색에 맡깁니다.
+ * 디버그: paradise.nav.flow.DebugDraw, 통계: 'stat ParadiseFlow'
+ */
+UCLASS()
+class PARADISE_API UFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+#pragma region 흐름장
+public:
+	/** @brief 목표(HomeBase)를 지정하고 흐름장 계산을 시작합니다. */
+	void SetGoal(AHomeBase* InGoal);
+
+	/** @brief 현재 목표 위치 */
+	FVector GetGoalLocation() const;
+
+	/** @brief 목표(HomeBase)가 지정되어 있는지 */
+	bool HasGoal() const { return Goal.IsValid(); }
+
+	/** @brief 사용할 수 있는 흐름장이 있는지 */
+	bool IsReady() const { return Active.IsValid(); }
+
+	/** @brief 위치가 현재 목표(HomeBase) 근처인지 (이동 목표가 HomeBase인지 판별용) */
+	bool IsGoalLocation(const FVector& Location) const;
+
+	/**
+	 * @brief 위치에서 목표로 향하는 방향을 샘플링합니다.
+	 * @return 흐름장 밖이거나 도달할 수 없는 셀이면 false
+	 */
+	bool SampleDirection(const FVector& Location, FVector& OutDirection) const;
+
+	/**
+	 * @brief 위치가 속한 셀의 네비메시 높이를 샘플링합니다. (액터 없이 지면을 따라가는 배경 유닛용)
+	 * @return 흐름장 밖이거나 네비메시 밖 셀이면 false
+	 */
+	bool SampleHeight(const FVector& Location, float& OutHeight) const;
+
+	/** @brief 흐름장 재계산 요청 (진행 중이면 처음부터 다시) */
+	void RequestRebuild();
+
+	/** @brief 현재 목표(HomeBase) */
+	AHomeBase* GetGoal() const { return Goal.Get(); }
+
+	/**
+	 * @brief 흐름장을 따라 위치에서 목표까지의 경유점을 만듭니다.
+	 * @details 방향이 바뀌는 셀 중심만 남기고, 마지막 점은 목표 위치입니다.
+	 * @return 비활성화 상태이거나 흐름장 밖/도달 불가 셀이면 false
+	 */
+	bool BuildPathToGoal(const FVector& Start, TArray<FVector>& OutPoints) const;
+
+	/**
+	 * @brief AI 컨트롤러 FindPathForMoveRequest용: 이동 목표가 HomeBase면 흐름장 경로를 만듭니다.
+	 * @return 경로를 만들었으면 true (false면 호출 측에서 일반 경로 탐색)
+	 */
+	/**
+	 * @brief 공유 목표를 블랙보드에 기록합니다. (TargetLocation = HomeBase 위치, HomeBaseActor가 비어 있으면 HomeBase)
+	 * @details AI 컨트롤러가 BT를 시작/재시작할 때 호출합니다. 목표가 아직 없으면 아무것도 하지 않습니다.
+	 */
+	void WriteGoalKeys(UBlackboardComponent& Blackboard) const;
+
+	static bool FindFlowPath(const AAIController& Controller, const FAIMoveRequest& MoveRequest, const FPathFindingQuery& Query, FNavPathSharedPtr& OutPath);
+#pragma endregion 흐름장
+
+#pragma region 흐름 추종
+public:
+	/**
+	 * @brief 유닛이 흐름장을 따라 목표로 이동하게 합니다.
+	 * @return 흐름장을 사용할 수 없으면 false (호출 측에서 일반 경로 탐색)
+	 */
+	bool StartFollowing(ABaseUnit* Unit);
+
+	void StopFollowing(ABaseUnit* Unit);
+
+	bool IsFollowing(const ABaseUnit* Unit) const { return Followers.Contains(Unit); }
+#pragma endregion 흐름 추종
+
+private:
+	enum class EBuildPhase : uint8
+	{
+		Idle,
+		Project,
+		Integrate,
+		Directions
+	};
+
+	/** @brief 네비메시 재생성 완료 알림 */
+	UFUNCTION()
+	void HandleNavigationGenerationFinished(ANavigationData* NavData);
+
+	/** @brief 예산만큼 계산을 진행합니다. */
+	void AdvanceBuild();
+
+	void BeginBuild();
+	void StepProject(int32 Budget);
+	void StepIntegrate(int32 Budget);
+	void StepDirections(int32 Budget);
+
+	/** @brief 두 셀 사이를 이동할 수 있는지 (대각선은 모서리 통과 금지) */
+	bool CanStep(const FFlowFieldData& Field, int32 FromX, int32 FromY, int32 ToX, int32 ToY) const;
+
+	/** @brief 팔로워 조향 */
+	void TickFollowers();
+
+	void DrawDebugField() const;
+
+	TWeakObjectPtr<AHomeBase> Goal;
+
+	/** @brief 조회에 사용하는 흐름장 */
+	FFlowFieldData Active;
+
+	/** @brief 계산 중인 흐름장 (완료되면 Active와 교체) */
+	FFlowFieldData Building;
+
+	EBuildPhase Phase = EBuildPhase::Idle;
+	int32 BuildCursor = 0;
+
+	/** @brief 계산 시작 시각 (통계용) */
+	double BuildStartTime = 0.0;
+
+	/** @brief 다익스트라 열린 목록 (비용, 셀 인덱스) 힙 */
+	TArray<TPair<float, int32>> OpenHeap;
+
+	/** @brief 계산 중 재계산 요청이 들어왔는지 */
+	bool bRebuildQueued = false;
+
+	/** @brief 흐름장을 따라 이동 중인 유닛 (키는 파괴된 뒤에도 지울 수 있도록 TObjectKey) */
+	TMap<TObjectKey<ABaseUnit>, TWeakObjectPtr<ABaseUnit>> Followers;
+};
@@ -4,30 +4,256 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
 #include "ObjectPoolSubsystem.generated.h"
 
 struct FActorSpawnParameters;
+class IObjectPoolInterface;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPoolPrewarmCompleted);
+
+/**
+ * @brief 클래스별 풀을 가리키는 핸들
+ * @details ResolvePoolHandle로 한 번만 조회해 캐싱해두면 이후 스폰 시 TMap 조회 없이 배열 인덱스로 접근합니다.
+ */
+struct FPoolClassHandle
+{
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * @brief 풀에서 꺼낸 액터 하나를 가리키는 세대(Generation) 검사 핸들
+ * @details 액터가 반납되었다가 다시 꺼내지면 세대가 바뀌므로,
+ * 예전 핸들로 반납을 시도하면(중복 반납/이미 재사용된 액터) 거부됩니다.
+ */
+struct FPooledActorHandle
+{
+	int32 SlotIndex = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return SlotIndex != INDEX_NONE; }
+};
+
+/**
+ * @brief 클래스(UClass) 단위로 집계되는 오브젝트 풀 통계
+ * @details 풀 크기를 감이 아닌 데이터로 산정하기 위한 지표입니다.
+ * Hit/Miss 비율, 최대 보유량(Peak), 미스 시 SpawnActor 비용 등을 기록합니다.
+ */
+USTRUCT(BlueprintType)
+struct FObjectPoolClassStats
+{
+	GENERATED_BODY()
+
+	/** @brief 통계 대상 클래스 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	TObjectPtr<UClass> PoolClass = nullptr;
+
+	/** @brief 풀에서 재사용에 성공한 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 HitCount = 0;
+
+	/** @brief 풀이 비어 있어 SpawnActor로 새로 생성한 횟수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 MissCount = 0;
+
+	/** @brief 풀에서 꺼냈지만 이미 파괴되어(IsValid 실패) 버려진 후보 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 InvalidDiscardCount = 0;
+
+	/** @brief 현재 풀에 대기 중인 액터 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 NumPooled = 0;
+
+	/** @brief 대기 액터 수의 최대치 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 PeakPooled = 0;
+
+	/** @brief 풀에서 꺼내져 현재 월드에서 활동 중인 액터 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 NumActive = 0;
+
+	/** @brief 활동 중인 액터 수의 최대치 (풀 크기 산정의 기준) */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 PeakActive = 0;
+
+	/** @brief 미스 시 SpawnActor에 소요된 누적 시간 (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	float TotalMissSpawnTimeMs = 0.f;
+
+	/** @brief 미스 1회당 SpawnActor 최대 소요 시간 (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	float MaxMissSpawnTimeMs = 0.f;
+
+	/** @brief 용량 초과/유휴/메모리 압박으로 풀에 넣지 않고 파괴한 액터 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 TrimmedCount = 0;
+
+	/** @brief 세대 불일치/중복 반납으로 거부된 반납 요청 수 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int32 RejectedReturnCount = 0;
+
+	/** @brief 액터 1개당 추정 메모리 (Exclusive, 바이트) - 처음 풀에 들어올 때 1회 측정 */
+	UPROPERTY(BlueprintReadOnly, Category = "ObjectPool|Stats")
+	int64 EstimatedBytesPerActor = 0;
+
+	/** @brief 전체 요청 대비 재사용 성공 비율 (0~1) */
+	float GetHitRate() const
+	{
+		const int32 Total = HitCount + MissCount;
+		return Total > 0 ? static_cast<float>(HitCount) / Total : 0.f;
+	}
+};
+
+/**
+ * @brief 풀 예열(Prewarm) 요청 단위
+ * @details 지정한 클래스를 Count개 만큼 미리 생성해 풀에 넣어둡니다.
+ */
+USTRUCT(BlueprintType)
+struct FPoolPrewarmRequest
+{
+	GENERATED_BODY()
+
+	/** @brief 미리 생성할 액터 클래스 (IObjectPoolInterface 구현 필수) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	TSubclassOf<AActor> ActorClass;
+
+	/** @brief 추가로 생성할 개수 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	int32 Count = 1;
+
+	/** @brief 생성 위치 (생성 직후 숨겨지므로 스포너 근처 등 안전한 위치면 충분) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ObjectPool")
+	FVector SpawnLocation = FVector::ZeroVector;
+};
+
+/** @brief 활성화/비활성화 훅 호출 방식 (클래스 단위로 1회 판별해 캐싱) */
+enum class EPoolDispatchMode : uint8
+{
+	/** 인터페이스 미구현 - 풀링 불가 */
+	None,
+	/** C++ 구현만 존재 - 가상 함수(_Implementation)를 직접 호출 */
+	Native,
+	/** 블루프린트 구현/오버라이드 존재 - Execute_ 리플렉션 호출 */
+	Reflection,
+};
+
+/** @brief 풀이 관리하는 액터 한 개의 슬롯 */
+USTRUCT()
+struct FPooledActorSlot
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Actor = nullptr;
+
+	/** @brief Native 디스패치용 인터페이스 포인터 (슬롯 할당 시 1회 캐싱) */
+	IObjectPoolInterface* NativeInterface = nullptr;
+
+	/** @brief 소속 풀 인덱스 (FPoolClassHandle::Index) */
+	int32 PoolIndex = INDEX_NONE;
+
+	/** @brief 풀에서 꺼내질 때마다 증가하는 세대 값 */
+	uint32 Generation = 0;
+
+	/** @brief 현재 풀에 대기 중인지 여부 (중복 반납 방지) */
+	bool bInPool = false;
+};
 
 USTRUCT()
 struct FObjectPoolQueue
 {
 	GENERATED_BODY()
 
+	/** @brief 대기 중인 슬롯 인덱스 (LIFO, 오래된 것이 앞쪽) */
+	TArray<int32> PooledSlots;
+
+	/** @brief PooledSlots와 같은 인덱스의 슬롯이 풀에 들어온 시각 */
+	TArray<double> PooledSince;
+
+	/** @brief 이 풀(클래스)의 누적 통계 */
 	UPROPERTY()
-	TArray<TObjectPtr<AActor>> Pool;
+	FObjectPoolClassStats Stats;
+
+	/** @brief 활성화/비활성화 훅 호출 방식 */
+	EPoolDispatchMode DispatchMode = EPoolDispatchMode::None;
+
+	/** @brief 최대 보유량 (0 이하면 paradise.pool.DefaultCapacity 사용) */
+	int32 Capacity = 0;
+
+	/** @brief 유휴 트리밍 시에도 남겨둘 최소 개수 (예열 요청량) */
+	int32 MinRetain = 0;
+
+	/** @brief 마지막으로 꺼내거나 반납된 시각 (LRU 퇴출 기준) */
+	double LastUsedTime = 0.0;
+
+	/** @brief RunSpawnBenchmark 전용 풀 (클래스 조회/통계 목록에서 제외) */
+	bool bBenchmarkOnly = false;
+
+	int32 NumPooled() const { return PooledSlots.Num(); }
+
+	void Push(int32 SlotIndex, double Now)
+	{
+		PooledSlots.Push(SlotIndex);
+		PooledSince.Push(Now);
+	}
+
+	int32 Pop()
+	{
+		PooledSince.Pop(EAllowShrinking::No);
+		return PooledSlots.Pop(EAllowShrinking::No);
+	}
+
+	/** @brief 가장 오래 대기한 슬롯부터 Count개를 풀에서 제거해 반환합니다. */
+	void RemoveOldest(int32 Count, TArray<int32>& OutRemoved)
+	{
+		Count = FMath::Min(Count, PooledSlots.Num());
+		OutRemoved.Append(PooledSlots.GetData(), Count);
+		PooledSlots.RemoveAt(0, Count, EAllowShrinking::No);
+		PooledSince.RemoveAt(0, Count, EAllowShrinking::No);
+	}
 };
 /**
  * @brief 월드 기반 오브젝트 풀링 시스템을 관리하는 서브시스템입니다.
  * @note Actor의 재사용 및 관리를 담당합니다.
+ * 클래스별 풀은 핸들(FPoolClassHandle)로, 꺼낸 액터는 세대 검사 핸들(FPooledActorHandle)로 관리합니다.
+ * 인터페이스 구현 여부와 호출 방식(Native/Reflection)은 클래스당 1회만 판별합니다.
+ * 예열(Prewarm) 요청은 Tick에서 프레임당 예산(paradise.pool.PrewarmBudgetMs) 안에서 나눠 처리합니다.
+ * 보유량은 클래스별 용량, 유휴 시간 트리밍, 전역 메모리 예산(LRU 클래스 우선 퇴출)으로 제한되며
+ * 엔진의 저메모리 알림(FCoreDelegates::GetMemoryTrimDelegate)을 받으면 대기 중인 액터를 비웁니다.
+ * 통계는 'stat ParadisePool' 또는 콘솔 명령 'paradise.pool.dump'로 확인할 수 있습니다.
  * @see IObjectPoolInterface
  */
 UCLASS()
-class PARADISE_API UObjectPoolSubsystem : public UWorldSubsystem
+class PARADISE_API UObjectPoolSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief 클래스의 풀 핸들을 조회(없으면 생성)합니다.
+	 * @details 인터페이스 구현 여부와 훅 호출 방식도 이때 1회 판별해 캐싱합니다.
+	 * 스포너처럼 같은 클래스를 반복 스폰하는 쪽은 이 핸들을 보관해두고 사용하세요.
+	 */
+	FPoolClassHandle ResolvePoolHandle(UClass* Class);
+
+	/**
+	 * @brief 핸들 기반 스폰 (TMap 조회 없음)
+	 * @param PoolHandle ResolvePoolHandle로 얻은 핸들
+	 * @param OutHandle  (선택) 꺼낸 액터의 세대 검사 핸들
+	 * @return 활성화된 액터 (실패 시 nullptr)
+	 */
+	AActor* SpawnFromPool(FPoolClassHandle PoolHandle, const FVector& Location, const FRotator& Rotation,
+		AActor* Owner, APawn* Instigator, FPooledActorHandle* OutHandle = nullptr);
+
 	/**
 	 * @brief 풀에서 액터를 가져올 때 특정 타입(T)으로 캐스팅하여 반환하는 템플릿 함수
 	 * @tparam T      반환받을 액터의 구체적인 클래스 타입 (AActor 상속 필수)
@@ -44,10 +270,18 @@ public:
 		return Cast<T>(SpawnPooledActor(Class, location, rotation, Owner, Instigator));
 	}
 
+	/** @brief 핸들 기반 템플릿 스폰 */
+	template<typename T>
+	T* SpawnPoolActor(FPoolClassHandle PoolHandle, const FVector& Location, const FRotator& Rotation, AActor* Owner, APawn* Instigator, FPooledActorHandle* OutHandle = nullptr)
+	{
+		return Cast<T>(SpawnFromPool(PoolHandle, Location, Rotation, Owner, Instigator, OutHandle));
+	}
+
 	/**
 	 * @brief 오브젝트 풀을 조회하여 액터를 가져오거나, 없으면 새로 생성하는 핵심 함수
 	 * @details 풀(Queue)에 유효한 액터가 있다면 재사용(Reuse)하고, 없다면 SpawnActor를 통해 새로 생성합니다.
 	 * 가져온 액터에 대해 IObjectPoolInterface::OnPoolActivate를 호출합니다.
+	 * 내부적으로 ResolvePoolHandle 후 핸들 기반 스폰을 호출합니다.
 	 * * @param Class    스폰할 대상 UClass
 	 * @param location 초기 위치
 	 * @param rotation 초기 회전
@@ -58,20 +292,179 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ObjectPool")
 	AActor* SpawnPooledActor(UClass* Class, FVector location, FRotator rotation, AActor* Owner, APawn* Instigator);
 
+	/**
+	 * @brief 핸들 기반 반납
+	 * @details 세대가 일치하고 현재 활성 상태인 경우에만 반납합니다. (중복/지연 반납 방지)
+	 * @return 반납에 성공하면 true
+	 */
+	bool ReleaseToPool(const FPooledActorHandle& Handle);
 
 	/**
 	 * @brief 사용이 끝난 액터를 풀로 반납(비활성화)하는 함수
 	 * @details 액터를 즉시 Destroy하지 않고 숨긴 뒤, 풀 큐에 넣습니다.
 	 * 반납 전 IObjectPoolInterface::OnPoolDeactivate를 호출합니다.
+	 * 이미 풀에 있는 액터를 다시 반납하면 무시합니다.
 	 * * @param InActor 풀로 되돌릴 대상 액터
 	 */
 	UFUNCTION(BlueprintCallable, Category = "ObjectPool")
 	void ReturnToPool(AActor* InActor);
 
+	/** @brief 액터의 현재 핸들을 조회합니다. (풀이 관리하지 않는 액터면 무효 핸들) */
+	FPooledActorHandle FindActorHandle(const AActor* InActor) const;
+
+	/** @brief 핸들이 가리키는 액터 (세대 불일치 시 nullptr) */
+	AActor* ResolveActorHandle(const FPooledActorHandle& Handle) const;
+
+#pragma region 예열 (Prewarm)
+public:
+	/**
+	 * @brief 풀 예열을 요청합니다.
+	 * @details 요청은 큐에 쌓이고, 매 프레임 예산(ms) 안에서 하나씩 SpawnActor 후 즉시 풀에 넣습니다.
+	 * 여러 번 호출하면 요청이 누적됩니다. 모든 요청이 끝나면 OnPrewarmCompleted가 호출됩니다.
+	 * @param Requests (클래스, 개수) 요청 목록
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Prewarm")
+	void RequestPrewarm(const TArray<FPoolPrewarmRequest>& Requests);
+
+	/** @brief 처리 대기 중인 예열 요청이 남아 있는지 여부 */
+	UFUNCTION(BlueprintPure, Category = "ObjectPool|Prewarm")
+	bool IsPrewarming() const { return PendingPrewarms.Num() > 0; }
+
+	/** @brief 현재 예열 배치의 진행률 (0~1, 대기 중인 요청이 없으면 1) */
+	UFUNCTION(BlueprintPure, Category = "ObjectPool|Prewarm")
+	float GetPrewarmProgress() const;
+
+	/** @brief 대기 중인 예열 요청이 모두 처리되었을 때 호출됩니다. */
+	UPROPERTY(BlueprintAssignable, Category = "ObjectPool|Prewarm")
+	FOnPoolPrewarmCompleted OnPrewarmCompleted;
+
+private:
+	/** @brief 예열 큐를 예산 안에서 처리합니다. */
+	void ProcessPrewarmQueue();
+#pragma endregion 예열 (Prewarm)
+
+#pragma region 용량 관리
+public:
+	/**
+	 * @brief 특정 클래스의 풀 최대 보유량을 설정합니다.
+	 * @details 가득 찬 상태에서 반납되는 액터는 풀에 넣지 않고 파괴합니다.
+	 * @param Class    대상 클래스
+	 * @param Capacity 최대 보유량 (0 이하면 기본값 paradise.pool.DefaultCapacity 사용)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Capacity")
+	void SetPoolCapacity(UClass* Class, int32 Capacity);
+
+	/**
+	 * @brief 대기 중인 액터를 정리합니다.
+	 * @param bAggressive true면 최소 보유량(MinRetain)까지 무시하고 모두 비웁니다. (저메모리 대응)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Capacity")
+	void TrimPools(bool bAggressive);
+
+	/** @brief 현재 대기 중인 액터들의 추정 메모리 총합 (바이트) */
+	int64 GetEstimatedPooledBytes() const;
+
 private:
+	/** @brief 유휴 시간을 넘긴 대기 액터를 파괴합니다. */
+	void TrimIdleActors(double Now);
+
+	/** @brief 전역 메모리 예산을 넘으면 가장 오래 쓰지 않은 클래스의 풀부터 비웁니다. */
+	void EnforceMemoryBudget();
+
+	/** @brief 대기 액터를 파괴하고 통계를 갱신합니다. */
+	void DestroyPooledActors(FObjectPoolQueue& PoolQueue, int32 Count);
+
+	/** @brief 해당 풀의 실제 용량 (개별 설정 또는 기본값) */
+	int32 GetEffectiveCapacity(const FObjectPoolQueue& PoolQueue) const;
+
+	/** @brief 엔진 저메모리 알림 콜백 (다른 스레드에서 올 수 있으므로 플래그만 세웁니다) */
+	void HandleLowMemory();
+
+	FDelegateHandle MemoryTrimHandle;
+
+	/** @brief 저메모리 알림 수신 여부 (다음 Tick에서 처리) */
+	std::atomic<bool> bPendingLowMemoryTrim { false };
+
+	/** @brief 다음 유휴 트리밍 검사 시각 */
+	double NextTrimCheckTime = 0.0;
+#pragma endregion 용량 관리
+
+#pragma region 통계
+public:
+	/**
+	 * @brief 특정 클래스의 풀 통계를 조회합니다.
+	 * @param Class    조회할 클래스
+	 * @param OutStats 조회 결과
+	 * @return 해당 클래스의 풀이 존재하면 true
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Stats")
+	bool GetPoolStats(UClass* Class, FObjectPoolClassStats& OutStats) const;
 
-	/** * @brief 클래스 타입(UClass*)을 키(Key)로 하여 관리되는 오브젝트 풀 맵
+	/** @brief 모든 클래스의 풀 통계를 배열로 반환합니다. */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Stats")
+	TArray<FObjectPoolClassStats> GetAllPoolStats() const;
+
+	/**
+	 * @brief 누적 카운터(Hit/Miss/Discard/Peak/시간)를 초기화합니다.
+	 * @note 현재 보유량(NumPooled/NumActive)은 실제 상태이므로 유지됩니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ObjectPool|Stats")
+	void ResetPoolStats();
+
+	/** @brief 전체 풀 통계를 로그로 출력합니다. (paradise.pool.dump) */
+	void DumpPoolStats() const;
+
+	/**
+	 * @brief 스폰/반납 1회 비용을 이전 방식(TMap + IsValid 루프 + Implements/Execute_)과 핸들 방식으로 비교 측정합니다.
+	 * @details paradise.pool.bench 콘솔 명령에서 사용합니다. 초당 SpawnsPerSecond회 스폰 시의 초당 비용도 함께 출력합니다.
+	 * 게임 풀과 분리된 클래스별 전용 풀에서 측정하고, 끝나면 벤치 액터를 파괴합니다.
+	 * @warning 벤치 액터도 실제 활성화/비활성화 훅(격자 등록, LOD 등)을 거치므로 게임 진행 중에는 실행하지 마세요.
+	 * 게임 월드가 일시정지되어 있지 않으면 측정하지 않고 에러 로그만 남깁니다.
+	 * @param Class           측정할 클래스 (IObjectPoolInterface 구현 필수)
+	 * @param SpawnsPerSecond 측정 반복 횟수 (= 1초 분량)
 	 */
+	void RunSpawnBenchmark(UClass* Class, int32 SpawnsPerSecond);
+#pragma endregion 통계
+
+private:
+	/** @brief 클래스의 벤치마크 전용 풀 핸들 (없으면 생성, PoolIndexMap에 등록하지 않음) */
+	FPoolClassHandle ResolveBenchmarkPoolHandle(UClass* Class);
+
+	/** @brief 슬롯 하나를 할당하고 액터를 등록합니다. */
+	int32 AllocateSlot(AActor* InActor, int32 PoolIndex);
+
+	/** @brief 슬롯을 해제합니다. (액터 파괴/유실 시) */
+	void FreeSlot(int32 SlotIndex);
+
+	/** @brief 슬롯의 액터를 비활성화해 풀에 넣습니다. 용량 초과 시 파괴합니다. */
+	void ReturnSlotToPool(int32 SlotIndex);
+
+	/** @brief 클래스별 풀 (FPoolClassHandle::Index로 접근) */
 	UPROPERTY()
-	TMap<UClass*, FObjectPoolQueue> PoolMap;
-};
\ No newline at end of file
+	TArray<FObjectPoolQueue> Pools;
+
+	/** * @brief 클래스 타입(UClass*)을 키(Key)로 한 풀 인덱스 맵 (핸들 조회 시에만 사용)
+	 */
+	TMap<TObjectKey<UClass>, int32> PoolIndexMap;
+
+	/** @brief 클래스 → 벤치마크 전용 풀 인덱스 */
+	TMap<TObjectKey<UClass>, int32> BenchmarkPoolIndexMap;
+
+	/** @brief 풀이 관리하는 모든 액터 슬롯 */
+	UPROPERTY()
+	TArray<FPooledActorSlot> Slots;
+
+	/** @brief 재사용 가능한 빈 슬롯 인덱스 */
+	TArray<int32> FreeSlots;
+
+	/** @brief 액터 → 슬롯 인덱스 (UClass* / AActor* 기반 API 호환용) */
+	TMap<TObjectKey<AActor>, int32> ActorSlotMap;
+
+	/** @brief 아직 처리되지 않은 예열 요청 (Count는 남은 개수) */
+	UPROPERTY()
+	TArray<FPoolPrewarmRequest> PendingPrewarms;
+
+	/** @brief 현재 예열 배치의 전체/완료 개수 (진행률 계산용) */
+	int32 PrewarmBatchTotal = 0;
+	int32 PrewarmBatchDone = 0;
+};
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NavigationData.h"
+#include "PathCacheSubsystem.generated.h"
+
+class AAIController;
+class ARecastNavMesh;
+struct FAIMoveRequest;
+
+/** @brief 캐시 키: 출발/도착 지점이 속한 네비메시 폴리곤 */
+struct FPathCacheKey
+{
+	NavNodeRef StartPoly = INVALID_NAVNODEREF;
+	NavNodeRef GoalPoly = INVALID_NAVNODEREF;
+
+	bool operator==(const FPathCacheKey& Other) const
+	{
+		return StartPoly == Other.StartPoly && GoalPoly == Other.GoalPoly;
+	}
+
+	friend uint32 GetTypeHash(const FPathCacheKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.StartPoly), GetTypeHash(Key.GoalPoly));
+	}
+};
+
+/** @brief 캐시된 경로 통로 (경로 점 + 폴리곤 통로) */
+struct FPathCacheEntry
+{
+	TArray<FNavPathPoint> Points;
+	TArray<NavNodeRef> Corridor;
+	TArray<FVector::FReal> CorridorCost;
+
+	/** @brief 생성 시각 (월드 시간, 만료 판정) */
+	double CreatedTime = 0.0;
+
+	/** @brief 마지막 사용 시각 (용량 초과 시 오래된 것부터 제거) */
+	double LastUsedTime = 0.0;
+};
+
+/**
+ * @class UPathCacheSubsystem
+ * @brief 같은 스포너에서 나온 유닛들이 경로 통로를 공유하도록 하는 경로 캐시
+ * @details
+ * - 키: (출발 폴리곤, 도착 폴리곤). 폴리곤은 볼록하므로 같은 폴리곤 안의 다른 출발/도착점으로
+ *   기존 경로의 양 끝만 바꿔 붙여(Splice) 재사용합니다.
+ * - 붙인 구간은 네비메시 레이캐스트로 확인하고, 막혀 있으면 새로 경로를 탐색합니다.
+ * - 네비메시가 다시 생성되면 전체 무효화, 항목은 paradise.nav.pathcache.MaxAge 초 뒤 만료됩니다.
+ * - AI 컨트롤러의 FindPathForMoveRequest에서 FindMovePath로 조회하므로 BT의 엔진 MoveTo도 캐시를 씁니다.
+ * 통계: 'stat ParadisePathCache', 적중률: paradise.nav.pathcache.Stats
+ */
+UCLASS()
+class PARADISE_API UPathCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief 컨트롤러 폰 위치에서 목표까지의 경로를 캐시에서 찾거나 새로 탐색합니다.
+	 * @param bAllowPartialPath 캐시 실패로 새로 탐색할 때 부분 경로를 허용할지 (이동 요청 설정을 그대로 전달)
+	 * @return 경로를 만들 수 없으면 nullptr (호출 측에서 일반 경로 탐색으로 처리)
+	 */
+	FNavPathSharedPtr FindPath(const AAIController& Controller, const FVector& GoalLocation, bool bAllowPartialPath = true);
+
+	/**
+	 * @brief AI 컨트롤러 FindPathForMoveRequest용: 이동 요청의 목표로 FindPath를 호출합니다.
+	 * @details 전용 필터를 쓰는 요청은 캐시 키(기본 필터)와 맞지 않으므로 건너뜁니다.
+	 * @return 경로를 찾았으면 true (false면 호출 측에서 일반 경로 탐색)
+	 */
+	static bool FindMovePath(const AAIController& Controller, const FAIMoveRequest& MoveRequest, FNavPathSharedPtr& OutPath);
+
+	/** @brief 캐시 전체 무효화 */
+	void Invalidate();
+
+	int32 GetNumEntries() const { return Entries.Num(); }
+
+	/** @brief 누적 적중/실패 수 */
+	int64 GetNumHits() const { return NumHits; }
+	int64 GetNumMisses() const { return NumMisses; }
+
+private:
+	/** @brief 네비메시 재생성 완료 알림 */
+	UFUNCTION()
+	void HandleNavigationGenerationFinished(ANavigationData* NavData);
+
+	/** @brief 캐시된 통로의 양 끝을 새 출발/도착점으로 바꿔 경로를 만듭니다. (붙인 구간이 막혀 있으면 nullptr) */
+	FNavPathSharedPtr SplicePath(const FPathCacheEntry& Entry, const ARecastNavMesh& NavMesh, FSharedConstNavQueryFilter Filter,
+		const AAIController& Controller, const FNavPathPoint& Start, const FNavPathPoint& Goal) const;
+
+	/** @brief 완전한 경로를 캐시에 저장합니다. */
+	void StoreEntry(const FPathCacheKey& Key, const FNavigationPath& Path, double Now);
+
+	/** @brief 용량 초과 시 가장 오래 사용하지 않은 항목 제거 */
+	void EvictIfNeeded();
+
+	TMap<FPathCacheKey, FPathCacheEntry> Entries;
+
+	int64 NumHits = 0;
+	int64 NumMisses = 0;
+};
@@ -0,0 +1,186 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "Data/Structs/ProjectileStructs.h"
+#include "ProjectileSubsystem.generated.h"
+
+class UProjectileConfig;
+class UGameplayEffect;
+class UInstancedStaticMeshComponent;
+
+/**
+ * @brief 투사체 종류 한 개 (설정 + 인스턴스 메시)
+ */
+USTRUCT()
+struct FProjectileType
+{
+	GENERATED_BODY()
+
+	FGameplayTag Tag;
+	FProjectileTypeSettings Settings;
+
+	/** @brief 이 종류의 모든 투사체를 그리는 인스턴스 (메시가 없으면 nullptr) */
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+
+	/** @brief 프레임마다 재사용하는 인스턴스 트랜스폼 버퍼 */
+	TArray<FTransform> InstanceTransforms;
+};
+
+/**
+ * @brief 비행 중인 투사체 전체의 SoA 데이터
+ * @details 같은 인덱스가 투사체 한 개입니다. 제거는 마지막 항목과 교체(RemoveAtSwap)합니다.
+ */
+struct FProjectileArray
+{
+	TArray<FVector> Location;
+
+	/** @brief 지난 프레임 위치 (이번 프레임 스윕 시작점) */
+	TArray<FVector> PrevLocation;
+	TArray<FVector> Velocity;
+	TArray<float> Age;
+	TArray<float> Damage;
+	TArray<uint16> TypeIndex;
+
+	/** @brief 쏜 유닛의 진영 ID (적대 판정) */
+	TArray<uint8> FactionId;
+
+	/** @brief UProjectileSubsystem::DamageEffects 인덱스 (MAX_uint16 = 없음) */
+	TArray<uint16> EffectIndex;
+	TArray<TWeakObjectPtr<AActor>> Instigator;
+
+	/** @brief 지난 프레임에 발행한 비동기 스윕 */
+	TArray<FTraceHandle> PendingTrace;
+
+	int32 Num() const { return Location.Num(); }
+
+	int32 Add(const FVector& InLocation, const FVector& InVelocity, float InDamage, uint16 InTypeIndex, uint8 InFactionId, uint16 InEffectIndex, AActor* InInstigator);
+	void RemoveAtSwap(int32 Index);
+	void Reset();
+};
+
+/**
+ * @class UProjectileSubsystem
+ * @brief 원거리 유닛의 투사체를 액터 없이 한 번에 시뮬레이션하는 월드 서브시스템
+ * @details
+ * - 투사체는 위치/속도/수명/데미지만 SoA로 들고, 이동은 ParallelFor로 한 번에 적분합니다.
+ * - 충돌은 투사체마다 이번 프레임 이동 구간의 비동기 구체 스윕(AsyncSweepByChannel)으로 판정하고,
+ *   결과는 다음 프레임 Tick에서 한꺼번에 처리합니다. (게임 스레드 대기 없음, 판정이 한 프레임 늦음)
+ * - 유닛에는 겹침(Overlap)으로 반응하므로 아군을 통과하고, 적대 진영 유닛에게 맞으면 사라집니다. 지형에는 막힙니다.
+ * - 데미지: 대상에 ASC가 있으면 쏜 유닛의 BasicAttackEffect를 GAS 스펙으로 적용 (Data.Damage.Base SetByCaller),
+ *   ASC가 없는 유닛(ABaseUnit)은 데미지 큐(UDamageQueueSubsystem)에 게시합니다.
+ * - 종류(UProjectileConfig)마다 ISM 하나로 그립니다.
+ * 부하 측정: paradise.projectile.stress N, 통계: 'stat ParadiseProjectile'
+ */
+UCLASS()
+class PARADISE_API UProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 종류별 설정을 교체합니다. (nullptr이면 기본 종류 하나) 비행 중인 투사체는 제거됩니다. */
+	void SetConfig(const UProjectileConfig* InConfig);
+
+	/** @brief 종류 태그의 설정 (없으면 기본 종류) */
+	const FProjectileTypeSettings& GetTypeSettings(const FGameplayTag& TypeTag) const;
+
+	/**
+	 * @brief 투사체를 발사합니다.
+	 * @param Shooter       쏜 액터 (자기 자신은 맞지 않음, 데미지 Instigator)
+	 * @param TypeTag       투사체 종류 (UProjectileConfig)
+	 * @param Start         발사 위치
+	 * @param Direction     발사 방향 (정규화하지 않아도 됨)
+	 * @param Damage        데미지
+	 * @param FactionId     쏜 유닛의 진영 ID (이 진영에 적대인 유닛만 맞음)
+	 * @param DamageEffect  ASC가 있는 대상에게 적용할 GE (비우면 AI 유닛에게만 데미지 큐로 처리, ASC 대상은 경고 후 무시)
+	 * @return 최대 개수(paradise.projectile.MaxProjectiles)를 넘으면 false
+	 */
+	bool FireProjectile(AActor* Shooter, const FGameplayTag& TypeTag, const FVector& Start, const FVector& Direction,
+		float Damage, uint8 FactionId, TSubclassOf<UGameplayEffect> DamageEffect);
+
+	/** @brief 비행 중인 투사체를 모두 제거합니다. */
+	void ClearProjectiles();
+
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+#pragma region 부하 측정
+public:
+	/** @brief 플레이어 주변에서 투사체 Count개가 항상 날아다니도록 계속 발사합니다. (0이면 정리) */
+	void StartStressTest(int32 Count);
+#pragma endregion 부하 측정
+
+private:
+	/** @brief 지난 프레임 스윕 결과로 명중 처리 (명중한 투사체는 Removed에 표시) */
+	void ProcessTraceResults();
+
+	/** @brief 투사체 한 개를 대상에게 명중시킵니다. */
+	void ApplyHit(int32 Index, AActor* HitActor);
+
+	/** @brief 데미지 GE 없이 쏜 투사체 경고 (쏜 액터 클래스당 1회) */
+	void WarnMissingDamageEffect(const AActor* Shooter);
+
+	/** @brief 명중/수명 만료 투사체 제거 */
+	void RemoveFinished();
+
+	/** @brief 이동 적분 */
+	void Integrate(float DeltaTime);
+
+	/** @brief 이번 프레임 이동 구간의 비동기 스윕 발행 */
+	void IssueTraces();
+
+	/** @brief 종류별 ISM 인스턴스 갱신 */
+	void UpdateInstances();
+
+	/** @brief 종류 태그의 인덱스 (없으면 0 = 기본 종류) */
+	uint16 FindTypeIndex(const FGameplayTag& TypeTag) const;
+
+	/** @brief 종류 한 개를 등록하고 ISM을 만듭니다. */
+	void AddType(const FGameplayTag& TypeTag, const FProjectileTypeSettings& Settings);
+
+	/** @brief ISM을 붙여둘 액터 (처음 필요할 때 생성) */
+	AActor* GetOrCreateInstanceOwner();
+
+	/** @brief 스트레스 투사체를 목표 개수까지 보충 */
+	void TickStressTest();
+
+	/** @brief 0번은 항상 기본 종류 */
+	UPROPERTY()
+	TArray<FProjectileType> Types;
+
+	TMap<FGameplayTag, uint16> TypeIndexByTag;
+
+	/** @brief 투사체가 참조하는 데미지 GE (투사체에는 인덱스만 저장) */
+	UPROPERTY()
+	TArray<TSubclassOf<UGameplayEffect>> DamageEffects;
+
+	/** @brief 데미지 GE 누락을 이미 경고한 클래스 */
+	TSet<TObjectKey<UClass>> WarnedNoEffectClasses;
+
+	UPROPERTY()
+	TObjectPtr<AActor> InstanceOwner = nullptr;
+
+	FProjectileArray Projectiles;
+
+	/** @brief 이번 프레임에 명중한 투사체 (ProcessTraceResults → RemoveFinished) */
+	TBitArray<> Removed;
+
+	/** @brief 유닛은 겹침, 나머지는 기본 응답 */
+	FCollisionResponseParams TraceResponseParams;
+
+	/** @brief ABaseUnit가 아닌 대상(플레이어 캐릭터)의 진영 ID */
+	uint8 PlayerFactionId = 0xFF;
+
+	int32 StressCount = 0;
+	FVector StressCenter = FVector::ZeroVector;
+};
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Interfaces/ParadiseScheduledAIWork.h"
+#include "UnitDeathEventSubsystem.generated.h"
+
+class AAIController;
+
+/**
+ * @brief 유닛이 전투에서 빠질 때 (사망 또는 풀 반납/파괴)
+ * @param Actor  빠지는 유닛
+ * @param bDied  true = 사망, false = 디스폰 (풀 반납, 배경 유닛 강등, 레벨 종료 등)
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnUnitRemovedFromPlay, AActor* /*Actor*/, bool /*bDied*/);
+
+/**
+ * @class UUnitDeathEventSubsystem
+ * @brief 사망/디스폰 이벤트 버스
+ * @details 블랙보드 TargetActor 대상이 죽었는지 주기적으로 확인하던 서비스(BTService_CheckTargetDeath)를 대체합니다.
+ * - AMyAIController는 블랙보드 TargetActor 키 옵저버로 현재 타겟을 구독합니다. (누가 키를 쓰든 자동)
+ * - ABaseUnit/ACharacterBase가 죽거나 디스폰되면 구독자들의 블랙보드를 즉시 비우고,
+ *   재타게팅을 UAIWorkSchedulerSubsystem에 예약합니다. (스케줄러가 꺼져 있으면 즉시 실행)
+ * 통계: 'stat ParadiseUnitEvents'
+ */
+UCLASS()
+class PARADISE_API UUnitDeathEventSubsystem : public UWorldSubsystem, public IParadiseScheduledAIWork
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Watcher가 Target의 사망/디스폰을 구독합니다. 이전 구독은 해제됩니다.
+	 * @param Target nullptr이면 구독 해제만
+	 */
+	void WatchTarget(AAIController* Watcher, AActor* Target);
+
+	/** @brief Watcher의 구독을 해제합니다. */
+	void UnwatchTarget(const AAIController* Watcher);
+
+	/** @brief 사망 알림 (Die에서 호출) */
+	void NotifyDeath(AActor* Actor);
+
+	/** @brief 디스폰 알림 (풀 반납/EndPlay에서 호출, 이미 사망 알림이 갔으면 구독자가 없어 바로 끝남) */
+	void NotifyDespawn(AActor* Actor);
+
+	/** @brief 유닛이 전투에서 빠질 때마다 호출됩니다. */
+	FOnUnitRemovedFromPlay OnUnitRemovedFromPlay;
+
+	/** @brief 구독 중인 컨트롤러 수 */
+	int32 GetNumWatchers() const { return TargetByWatcher.Num(); }
+
+	/** @brief 재타게팅 (스케줄러가 예산 안에서 호출) */
+	virtual void ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp) override;
+
+private:
+	void Broadcast(AActor* Actor, bool bDied);
+
+	/** @brief 타겟을 잃은 컨트롤러의 재타게팅을 예약합니다. */
+	void QueueRetarget(AAIController& Watcher);
+
+	/** @brief 대상 → 구독 중인 컨트롤러 */
+	TMap<TObjectKey<AActor>, TArray<TWeakObjectPtr<AAIController>>> WatchersByTarget;
+
+	/** @brief 컨트롤러 → 구독 중인 대상 (구독은 컨트롤러당 하나) */
+	TMap<TObjectKey<AAIController>, TObjectKey<AActor>> TargetByWatcher;
+};
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "UnitSensingSubsystem.generated.h"
+
+class AMyAIController;
+class ABaseUnit;
+
+/** @brief 감지 대상 컨트롤러 한 개 */
+struct FUnitSensor
+{
+	TWeakObjectPtr<AMyAIController> Controller;
+
+	/** @brief SensorIndexMap 키 (컨트롤러가 파괴된 뒤에도 맵에서 지울 수 있도록 보관) */
+	TObjectKey<AMyAIController> Key;
+
+	/** @brief 다음 감지 시각 (월드 시간) */
+	double NextSenseTime = 0.0;
+
+	/** @brief 시야 확인 트레이스 결과 대기 중 */
+	bool bTracePending = false;
+};
+
+/** @brief 센서 한 개 처리 결과 */
+enum class EUnitSenseResult : uint8
+{
+	Done,
+	TraceIssued,
+	/** @brief 시야 확인이 필요하지만 이번 프레임 트레이스 예산이 없음 */
+	Deferred
+};
+
+/** @brief 결과를 기다리는 시야 확인 트레이스 */
+struct FPendingSightTrace
+{
+	TWeakObjectPtr<AMyAIController> Controller;
+	TWeakObjectPtr<ABaseUnit> Target;
+};
+
+/**
+ * @class UUnitSensingSubsystem
+ * @brief AIPerception 대신 공간 격자로 적을 감지하는 경량 감지 서브시스템
+ * @details 컨트롤러마다 시야 처리를 돌리지 않고, 한 곳에서 적 진영만 조회합니다.
+ * - 후보: UUnitSpatialGridSubsystem::FindNearestEnemy (SightRadius 안)
+ * - 상실: 현재 타겟이 LoseSightRadius 밖 / 사망 / 숨김
+ * - (선택) 시야 확인: 비동기 라인 트레이스, 프레임당 paradise.ai.sensing.MaxTracesPerFrame 개까지
+ * 결과는 AMyAIController::ProcessSensedActor로 전달되어 AIPerception과 같은 경로로 TargetActor를 갱신합니다.
+ */
+UCLASS()
+class PARADISE_API UUnitSensingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** @brief 격자 감지를 사용할 컨트롤러 등록 (AIPerception을 쓰지 않는 유닛) */
+	void RegisterSensor(AMyAIController* Controller);
+
+	/** @brief 등록 해제 */
+	void UnregisterSensor(AMyAIController* Controller);
+
+	int32 GetNumSensors() const { return Sensors.Num(); }
+
+private:
+	/**
+	 * @brief 센서 하나를 처리합니다.
+	 * @param bLineOfSight 후보를 찾았을 때 시야 확인 트레이스를 할지
+	 * @param bCanTrace    이번 프레임 트레이스 예산이 남았는지
+	 */
+	EUnitSenseResult SenseOne(FUnitSensor& Sensor, double Now, bool bLineOfSight, bool bCanTrace);
+
+	/** @brief 비동기 트레이스 완료 콜백 */
+	void OnSightTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	void RemoveSensorAt(int32 SensorIndex);
+
+	TArray<FUnitSensor> Sensors;
+	TMap<TObjectKey<AMyAIController>, int32> SensorIndexMap;
+
+	/** @brief 트레이스 UserData → 요청 정보 */
+	TMap<uint32, FPendingSightTrace> PendingTraces;
+	uint32 NextTraceId = 1;
+
+	FTraceDelegate SightTraceDelegate;
+
+	/** @brief 트레이스 예산이 떨어졌을 때 다음 프레임에 이어서 처리할 위치 */
+	int32 SenseCursor = 0;
+};
@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "UnitSpatialGridSubsystem.generated.h"
+
+class ABaseUnit;
+
+/** @brief 그리드에 등록된 유닛 한 개 */
+struct FUnitGridEntry
+{
+	TWeakObjectPtr<ABaseUnit> Unit;
+
+	/** @brief EntryIndexMap 키 (유닛이 파괴된 뒤에도 맵에서 지울 수 있도록 보관) */
+	TObjectKey<ABaseUnit> Key;
+
+	/** @brief 마지막 Tick에서 갱신된 위치 */
+	FVector Location = FVector::ZeroVector;
+
+	/** @brief 현재 들어있는 셀 */
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** @brief 소속 진영 ID (FParadiseFactionTable) */
+	int32 FactionIndex = INDEX_NONE;
+};
+
+/** @brief 쿼리 결과 한 개 (거리 제곱 포함) */
+struct FUnitGridQueryResult
+{
+	ABaseUnit* Unit = nullptr;
+	float DistSq = 0.f;
+};
+
+/**
+ * @class UUnitSpatialGridSubsystem
+ * @brief 살아있는 ABaseUnit을 균일 격자(Spatial Hash)에 진영별로 보관하는 월드 서브시스템
+ * @details TActorIterator로 전체 유닛을 훑는 O(N²) 탐색을 대체합니다.
+ * - 등록: BeginPlay / OnPoolActivate, 해제: OnPoolDeactivate / EndPlay
+ * - 진영 변경(InitializeUnit)은 UpdateUnitFaction으로 버킷을 옮깁니다.
+ * - 위치는 Tick에서 한 번에 갱신하며, 셀이 바뀐 유닛만 버킷을 옮깁니다.
+ * - 쿼리: 반경(QueryRadius), K개 최근접(QueryKNearest), 최근접 적(FindNearestEnemy)
+ * 셀 크기는 paradise.grid.CellSize로 조절하며 통계는 'stat ParadiseGrid'로 확인합니다.
+ */
+UCLASS()
+class PARADISE_API UUnitSpatialGridSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+#pragma region 등록
+public:
+	/** @brief 유닛을 등록합니다. (이미 등록되어 있으면 무시) */
+	void RegisterUnit(ABaseUnit* Unit);
+
+	/** @brief 유닛 등록을 해제합니다. */
+	void UnregisterUnit(ABaseUnit* Unit);
+
+	/** @brief 유닛의 진영이 바뀌었을 때 버킷을 옮깁니다. (미등록이면 등록) */
+	void UpdateUnitFaction(ABaseUnit* Unit);
+
+	/** @brief 등록된 유닛 수 */
+	int32 GetNumUnits() const { return Entries.Num(); }
+
+	/** @brief 등록된 전체 항목 (배치 처리용, 읽기 전용) */
+	const TArray<FUnitGridEntry>& GetEntries() const { return Entries; }
+
+	/** @brief 버킷이 만들어진 진영 수 (진영 ID는 0 ~ GetNumFactions() - 1) */
+	int32 GetNumFactions() const { return FactionCells.Num(); }
+#pragma endregion 등록
+
+#pragma region 쿼리
+public:
+	/**
+	 * @brief 반경 안의 유닛을 찾습니다.
+	 * @param Center    중심
+	 * @param Radius    반경
+	 * @param OutUnits  결과 (초기화 후 채움, 순서 보장 없음)
+	 * @param EnemiesOf 지정 시 이 유닛의 적 진영만 검색 (자기 자신/사망 유닛 제외)
+	 */
+	void QueryRadius(const FVector& Center, float Radius, TArray<ABaseUnit*>& OutUnits, const ABaseUnit* EnemiesOf = nullptr) const;
+
+	/**
+	 * @brief 가까운 순서로 최대 K개의 유닛을 찾습니다.
+	 * @details 중심 셀부터 바깥 고리 순으로 넓혀가며, K개가 확정되면 중단합니다.
+	 * @param OutResults 결과 (가까운 순 정렬)
+	 */
+	void QueryKNearest(const FVector& Center, int32 K, float MaxRadius, TArray<FUnitGridQueryResult>& OutResults, const ABaseUnit* EnemiesOf = nullptr) const;
+
+	/**
+	 * @brief 가장 가까운 살아있는 적 유닛을 찾습니다.
+	 * @param OutDistance (선택) 찾은 적까지의 거리
+	 * @return 없으면 nullptr
+	 */
+	ABaseUnit* FindNearestEnemy(const ABaseUnit* Self, float MaxRadius, float* OutDistance = nullptr) const;
+#pragma endregion 쿼리
+
+private:
+	/** @brief 유닛의 진영 ID (버킷이 없으면 만듦) */
+	int32 ResolveFaction(const ABaseUnit* Unit);
+
+	/** @brief Self 기준 적 진영 마스크 (FParadiseFactionTable, IsEnemy와 같은 표) */
+	uint32 GetHostileFactions(const ABaseUnit* Self) const;
+
+	FIntPoint ToCell(const FVector& Location) const;
+
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+
+	/** @brief EntryIndex를 제거하고 마지막 항목을 그 자리로 옮깁니다. */
+	void RemoveEntryAt(int32 EntryIndex);
+
+	/** @brief 셀 하나를 검사하는 공통 루프 */
+	template<typename FunctorType>
+	void ForEachInCell(int32 FactionIndex, const FIntPoint& Cell, FunctorType&& Func) const;
+
+	TArray<FUnitGridEntry> Entries;
+	TMap<TObjectKey<ABaseUnit>, int32> EntryIndexMap;
+
+	/** @brief 진영별 셀 → 엔트리 인덱스 (인덱스 = 진영 ID) */
+	TArray<TMap<FIntPoint, TArray<int32>>> FactionCells;
+
+	/** @brief 셀 크기 (Initialize 시 CVar에서 읽음) */
+	float CellSize = 500.f;
+};
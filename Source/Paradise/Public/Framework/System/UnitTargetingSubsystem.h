@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AI/UnitTargetingSolver.h"
+#include "UnitTargetingSubsystem.generated.h"
+
+class ABaseUnit;
+
+/**
+ * @class UUnitTargetingSubsystem
+ * @brief 프레임마다 한 번, 살아있는 모든 유닛의 최근접 적을 일괄 계산하는 월드 서브시스템
+ * @details BT 서비스 인스턴스마다 하던 탐색을 하나의 배치로 모읍니다.
+ * - 유닛 목록/진영은 UUnitSpatialGridSubsystem에서 가져와 SoA 스냅샷을 만듭니다.
+ * - 계산은 FUnitTargetingSolver(셀 정렬 + ParallelFor + SIMD)가 담당합니다.
+ * - UBTService_FindClosestTarget은 결과 테이블을 읽기만 합니다. (1프레임 지연)
+ * paradise.ai.targeting.Enable로 끌 수 있으며 'stat ParadiseTargeting'으로 비용을 확인합니다.
+ */
+UCLASS()
+class PARADISE_API UUnitTargetingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief 탐색 반경을 요청합니다. (다음 배치부터 요청된 반경 중 최댓값으로 계산)
+	 * @param Radius BT 서비스의 SearchRadius
+	 */
+	void RequestSearchRadius(float Radius);
+
+	/**
+	 * @brief 마지막 배치에서 계산된 유닛의 최근접 적
+	 * @param OutTarget   가장 가까운 적 (반경 안에 없으면 nullptr)
+	 * @param OutDistance 적까지의 거리
+	 * @return 유닛이 결과 테이블에 있으면 true (이번 프레임 스폰 등으로 없으면 false → 호출 측에서 직접 탐색)
+	 */
+	bool GetNearestEnemy(const ABaseUnit* Unit, ABaseUnit*& OutTarget, float& OutDistance) const;
+
+	/**
+	 * @brief 기존 전수 검사 / 단일 스레드 / 병렬 솔버를 비교합니다.
+	 * @param UnitCounts 측정할 유닛 수 목록
+	 * @param Iterations 유닛 수당 반복 횟수
+	 */
+	static void RunBenchmark(const TArray<int32>& UnitCounts, int32 Iterations);
+
+private:
+	/** @brief 그리드에서 스냅샷을 만들고 솔버를 실행합니다. */
+	void SolveFrame();
+
+	FUnitTargetingSnapshot Snapshot;
+	FUnitTargetingResults Results;
+
+	/** @brief 스냅샷 슬롯 → 유닛 */
+	TArray<TWeakObjectPtr<ABaseUnit>> SlotUnits;
+
+	/** @brief 유닛 → 스냅샷 슬롯 */
+	TMap<TObjectKey<ABaseUnit>, int32> UnitSlots;
+
+	/** @brief 현재 계산에 사용하는 반경 (요청된 반경 중 최댓값) */
+	float SearchRadius = 0.f;
+};
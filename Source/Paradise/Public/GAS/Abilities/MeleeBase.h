@@ -46,7 +46,7 @@ protected:
 
 	/**
 	 * @brief WaitGameplayEvent 태스크에서 이벤트(타격)가 감지되었을 때 호출됩니다.
-	 * @param Payload 이벤트 데이터 (여기에 맞은 적 Target이 들어있음).
+	 * @param Payload 이벤트 데이터 (TargetData에 이번 프레임에 맞은 대상 전부, Target에 첫 대상이 들어있음).
 	 */
 	UFUNCTION()
 	void OnGameplayEventReceived(FGameplayEventData Payload);
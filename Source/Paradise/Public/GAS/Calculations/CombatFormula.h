@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+/**
+ * @file CombatFormula.h
+ * @brief 데미지 공식 (GAS/비GAS 공용, UObject 비의존)
+ * @details UExecCalcCombat(GAS)과 UDamageQueueSubsystem(AI 유닛)이 같은 식을 쓰도록 한 곳에 둡니다.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace ParadiseCombat
+{
+	/** @brief 치명타 피해 배율 기본값 (UBaseAttributeSet 초기값과 동일) */
+	static constexpr float DefaultCritDamage = 1.5f;
+
+	/**
+	 * @brief 치명타 판정
+	 * @param CritRate 치명타 확률 (0~1)
+	 * @param Roll     0~1 난수
+	 */
+	FORCEINLINE bool RollCritical(float CritRate, float Roll)
+	{
+		const float ClampedRate = FMath::Clamp(CritRate, 0.f, 1.f);
+		return ClampedRate > 0.f && Roll <= ClampedRate;
+	}
+
+	/**
+	 * @brief 최종 데미지
+	 * @details 공격력 x 배율 → 치명타 배율 → 방어력 비율 감소 100 / (100 + 방어력) → 최소 1
+	 * @param AttackPower 공격자 공격력
+	 * @param Multiplier  스킬/평타 배율 (평타 = 1)
+	 * @param Defense     피해자 방어력
+	 * @param bCritical   치명타 여부 (RollCritical)
+	 * @param CritDamage  치명타 피해 배율 (최소 1배)
+	 */
+	FORCEINLINE float ComputeDamage(float AttackPower, float Multiplier, float Defense, bool bCritical, float CritDamage)
+	{
+		float Damage = FMath::Max(AttackPower, 0.f) * Multiplier;
+
+		if (bCritical)
+		{
+			Damage *= FMath::Max(CritDamage, 1.f);
+		}
+
+		Damage *= 100.f / (100.f + FMath::Max(Defense, 0.f));
+
+		// 방어력이 높아도 최소 1은 들어감
+		return FMath::Max(Damage, 1.f);
+	}
+}
@@ -10,33 +10,57 @@ class UGameplayTagsManager;
 /**
  * @brief 싱글톤 패턴으로 구현된 네이티브 게임플레이 태그 관리자
  * @details C++ 코드에서 태그를 변수처럼 안전하게 접근하기 위해 사용합니다.
+ * - 모듈 시작 시(StartupModule) 한 번 네이티브 태그로 등록하고, 이후에는 문자열 조회 없이 멤버를 그대로 씁니다.
+ * - CDO/구조체 생성자처럼 모듈 시작보다 먼저 불릴 수 있는 곳을 위해 Get()이 처음 불릴 때도 등록합니다.
+ * - C++에서 FGameplayTag::RequestGameplayTag를 직접 부르지 않습니다. (검사: -run=ParadiseTagAudit)
  */
-struct FParadiseGameplayTags
+struct PARADISE_API FParadiseGameplayTags
 {
 public:
-	static const FParadiseGameplayTags& Get() { return GameplayTags; }
+	static const FParadiseGameplayTags& Get()
+	{
+		if (!GameplayTags.bInitialized)
+		{
+			InitializeNativeGameplayTags();
+		}
+		return GameplayTags;
+	}
+
+	/** @brief 모든 태그를 네이티브 태그로 등록합니다. (두 번째 호출부터는 아무것도 하지 않음) */
 	static void InitializeNativeGameplayTags();
 
 	// =========================================================
 	//  여기에 필요한 태그 변수를 선언합니다.
 	// =========================================================
 
-	// [속성]
-	FGameplayTag Attributes_Secondary_Armor;
-	FGameplayTag Attributes_Secondary_DamageMultiplier;
+	// [메타 / 데이터] SetByCaller용
+	FGameplayTag Data_Damage_Base;
+	FGameplayTag Data_Damage_Multiplier;
+
+	// [이벤트]
+	FGameplayTag Event_Montage_Hit;
 
-	// [전투 / 상태]
-	FGameplayTag Status_Debuff_Stun;
-	FGameplayTag Status_Debuff_Burn;
+	// [진영]
+	FGameplayTag Unit_Faction_Enemy;
+	FGameplayTag Unit_Faction_Neutral;
+	FGameplayTag Unit_Faction_Friendly;
+	FGameplayTag Unit_Faction_Friendly_Player;
+	FGameplayTag Unit_Faction_Friendly_Familiar;
 
-	// [속성 / 원소]
-	FGameplayTag Element_Fire;
-	FGameplayTag Element_Ice;
+	// [등급]
+	FGameplayTag Unit_Rank_Normal;
+	FGameplayTag Unit_Rank_S;
+	FGameplayTag Unit_Rank_A;
 
-	// [메타 / 데이터]
-	FGameplayTag Data_Damage_Base; // SetByCaller용
+	// [아이템 / 방어구 부위]
+	FGameplayTag Item_Type_Armor_Helmet;
+	FGameplayTag Item_Type_Armor_Chest;
+	FGameplayTag Item_Type_Armor_Gloves;
+	FGameplayTag Item_Type_Armor_Boots;
 
 protected:
 	// 싱글톤 인스턴스
 	static FParadiseGameplayTags GameplayTags;
+
+	bool bInitialized = false;
 };
@@ -0,0 +1,34 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "ParadiseScheduledAIWork.generated.h"
+
+class UBehaviorTreeComponent;
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UParadiseScheduledAIWork : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * @brief UAIWorkSchedulerSubsystem이 프레임 예산 안에서 대신 실행하는 BT 노드 작업
+ * @details 노드는 TickNode/ExecuteTask에서 작업을 예약만 하고, 실제 로직은 ExecuteScheduledWork에 둡니다.
+ * 같은 (BT 컴포넌트, 노드) 쌍은 큐에 하나만 들어갑니다.
+ */
+class PARADISE_API IParadiseScheduledAIWork
+{
+	GENERATED_BODY()
+
+public:
+
+	/*!
+	* @brief 스케줄러가 차례가 되었을 때 호출
+	* @param OwnerComp 작업을 예약한 BT 컴포넌트 (실행 시점에 유효성이 확인된 상태)
+	*/
+	virtual void ExecuteScheduledWork(UBehaviorTreeComponent& OwnerComp) = 0;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Data/Structs/UnitStructs.h"
+#include "Framework/System/ObjectPoolSubsystem.h"
 #include "UnitSpawner.generated.h"
 
 /** @brief 웨이브 설정을 위한 구조체 */
@@ -59,6 +60,14 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Spawning")
 	TArray<FWaveConfig> WaveConfigs;
 
+	/**
+	 * @brief 대량 스테이지용: 웨이브 유닛을 배경 유닛(UBackgroundUnitSubsystem)으로 스폰합니다.
+	 * @details 스쿼드/카메라의 교전 거리에 들어올 때만 풀에서 액터로 승격됩니다. 행에 ProxyMesh가 없으면 액터로 스폰합니다.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Spawning")
+	bool bSpawnAsBackground = false;
+
+	/** @brief 풀 예열 개수 (BeginPlay에서 풀 서브시스템에 프레임 분할 예열을 요청합니다) */
 	UPROPERTY(EditAnywhere, Category = "Spawning")
 	int32 PreSpawnCount = 5;
 
@@ -67,9 +76,16 @@ protected:
 	int32 CurrentSpawnCountInWave = 0;
 	FName EnemyRowName;
 
+	/** @brief UnitClass의 풀 핸들 (BeginPlay에서 1회 조회해 매 스폰마다 재사용) */
+	FPoolClassHandle UnitPoolHandle;
+
 	void SpawnUnit();
 	FVector GetRandomSpawnLocation();
 
+	/** @brief 첫 웨이브 타이머를 시작합니다. 풀 예열이 진행 중이면 완료 후에 호출됩니다. */
+	UFUNCTION()
+	void StartWaves();
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif